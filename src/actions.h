@@ -20,6 +20,14 @@ extern void action_jog_incremental(lv_event_t * e);
 extern void action_set_input_float(lv_event_t * e);
 extern void action_set_input_int(lv_event_t * e);
 extern void action_set_zero(lv_event_t * e);
+extern void action_run_divisions(lv_event_t * e);
+extern void action_select_axis(lv_event_t * e);
+extern void action_mill(lv_event_t * e);
+extern void action_feed_override(lv_event_t * e);
+extern void action_gear(lv_event_t * e);
+extern void action_home(lv_event_t * e);
+extern void action_clear_alarm(lv_event_t * e);
+extern void action_tune(lv_event_t * e);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,133 @@
+// Rotary Table position checkpoint
+
+#include "checkpoint.h"
+#include "crc.h"
+#include "motion.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <stddef.h>
+#include <string.h>
+
+// a saved position
+struct checkpoint_t {
+    uint32_t sequence;                  // higher is newer
+    int32_t position[MOTION_AXES];      // step position of each axis
+    uint32_t circle_steps[MOTION_AXES]; // steps in 360 degrees when saved
+    uint32_t crc;                       // of everything before it
+};
+
+static const char *slots[] = {"pos0", "pos1"};
+static const char *moving_key = "moving"; // sequence of the save moved from
+
+static Preferences prefs;
+static checkpoint_t saved;                 // last save
+static int32_t last_position[MOTION_AXES]; // positions at the last check
+static uint32_t still_time;                // time in mS the axes stopped
+static bool marked;                        // the move since saved is marked
+
+// mark the save as moved from as a move is posted, while the axes are
+// still stopped, a flash write holds up the motion core so one is never
+// made once they move, a feedback correction already moving them puts the
+// mark off to the next move
+static void checkpoint_mark() {
+    if (marked) {
+        return;
+    }
+    motion_status_t status;
+    motion_get_status(&status);
+    if (status.running) {
+        return;
+    }
+    prefs.putUInt(moving_key, saved.sequence);
+    marked = true;
+}
+
+// read the newest good checkpoint and set the axis positions from it, an
+// axis is only set if its drive settings are the same, an axis restored
+// from before a move is lost until it is homed or set
+// returns CHECKPOINT_NONE if no axis was set
+uint8_t checkpoint_load() {
+    prefs.begin("position", false);
+    motion_start_hook(checkpoint_mark);
+    checkpoint_t newest;
+    bool found = false;
+    for (const char *slot : slots) {
+        checkpoint_t checkpoint;
+        if (prefs.getBytes(slot, &checkpoint, sizeof(checkpoint)) !=
+                sizeof(checkpoint) ||
+            checkpoint.crc != crc32(&checkpoint, offsetof(checkpoint_t, crc))) {
+            continue;
+        }
+        if (!found || (int32_t)(checkpoint.sequence - newest.sequence) > 0) {
+            newest = checkpoint;
+            found = true;
+        }
+    }
+    if (!found) {
+        return CHECKPOINT_NONE;
+    }
+    // carry on the sequence even if the positions can't be used
+    saved = newest;
+    bool restored = false;
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        last_position[axis] = newest.position[axis];
+        if (newest.circle_steps[axis] == axis_config[axis].circle_steps) {
+            motion_post(MOTION_SET_POSITION, newest.position[axis], axis);
+            restored = true;
+        }
+    }
+    if (!restored) {
+        return CHECKPOINT_NONE;
+    }
+    // a move was started after it and not saved
+    uint32_t moved_from = prefs.getUInt(moving_key, newest.sequence + 1);
+    marked = moved_from == newest.sequence;
+    if (!marked) {
+        return CHECKPOINT_EXACT;
+    }
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        if (newest.circle_steps[axis] == axis_config[axis].circle_steps) {
+            motion_post(MOTION_POSITION_LOST, 0, axis);
+        }
+    }
+    return CHECKPOINT_MOVING;
+}
+
+// once the axes have been still for a while save the positions into the
+// slot the save before didn't use, or drop the mark if they are back where
+// they were saved, nothing is saved while an alarm is latched or an axis
+// is lost so the mark stays and the position isn't trusted after a power
+// cycle either
+void checkpoint_service() {
+    motion_status_t status;
+    motion_get_status(&status);
+    if (status.running || status.program ||
+        status.alarm != MOTION_ALARM_NONE || status.lost ||
+        memcmp(status.position, last_position, sizeof(last_position)) != 0) {
+        memcpy(last_position, status.position, sizeof(last_position));
+        still_time = millis();
+        return;
+    }
+    if (millis() - still_time < CHECKPOINT_DELAY) {
+        return;
+    }
+    if (memcmp(status.position, saved.position, sizeof(saved.position)) ==
+        0) {
+        if (marked) {
+            prefs.remove(moving_key);
+            marked = false;
+        }
+        return;
+    }
+    checkpoint_t checkpoint;
+    checkpoint.sequence = saved.sequence + 1;
+    memcpy(checkpoint.position, status.position, sizeof(checkpoint.position));
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        checkpoint.circle_steps[axis] = axis_config[axis].circle_steps;
+    }
+    checkpoint.crc = crc32(&checkpoint, offsetof(checkpoint_t, crc));
+    prefs.putBytes(slots[checkpoint.sequence & 1], &checkpoint,
+                   sizeof(checkpoint));
+    saved = checkpoint;
+    marked = false;
+}
@@ -0,0 +1,40 @@
+// Rotary Table position checkpoint
+//
+// the axis positions are saved to NVS once the axes have stopped and stayed
+// still for a while, so they can be restored after a power cycle without
+// zeroing the table again, the saves alternate between two slots with a
+// sequence number and a CRC so a save cut short by a power loss leaves the
+// one before it to restore, a position is only restored if the drive
+// settings of its axis are the same as when it was saved
+//
+// as a move is posted, before the axes start, the sequence of the last save
+// is written on its own as a small marker so flash is never written while
+// they move, a save after the move carries on the sequence so leaves the
+// marker behind, so a power loss before then leaves the marker on the
+// newest save, and that position is restored as one from before a move
+// rather than trusted, the axes are lost until they are homed or set
+//
+// a position an emergency stop or a stall alarm may have left off is not
+// saved until the axis is homed or set, or the stall alarm is cleared, so
+// it keeps the marker too
+//
+// an axis turned by hand while the power is off is not noticed
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stdint.h>
+
+#define CHECKPOINT_DELAY 1000 // mS the table is still before a save
+
+// what checkpoint_load() restored
+enum CHECKPOINT {
+    CHECKPOINT_NONE,   // no axis was set
+    CHECKPOINT_EXACT,  // the table at rest
+    CHECKPOINT_MOVING, // the table before a move the power cut short
+};
+
+uint8_t checkpoint_load();
+void checkpoint_service();
+
+#endif
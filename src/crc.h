@@ -0,0 +1,24 @@
+// Rotary Table CRC
+//
+// the CRC-32 used to check blobs saved to NVS
+
+#ifndef CRC_H
+#define CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC-32 of a block of bytes, bit at a time as the blobs are small
+static inline uint32_t crc32(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t crc = 0xffffffff;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 1 ? (crc >> 1) ^ 0xedb88320 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+#endif
@@ -0,0 +1,83 @@
+// Rotary Table encoder input
+
+#include "encoder.h"
+#if defined(ARDUINO)
+#include <Arduino.h>
+#include <driver/pcnt.h>
+#endif
+
+#if defined(ARDUINO)
+static const pcnt_unit_t unit = (pcnt_unit_t)ENCODER_UNIT;
+static volatile int32_t wraps; // counts the counter has wrapped by
+static int32_t last;           // count at the last read
+
+// the counter has reached a limit and gone back to 0
+static void IRAM_ATTR encoder_wrap(void *arg) {
+    uint32_t status;
+    pcnt_get_event_status(unit, &status);
+    if (status & PCNT_EVT_H_LIM) {
+        wraps += ENCODER_LIMIT;
+    } else if (status & PCNT_EVT_L_LIM) {
+        wraps -= ENCODER_LIMIT;
+    }
+}
+
+// both edges of A counted by the level of B and the other way round
+void encoder_start() {
+    pcnt_config_t config = {};
+    config.pulse_gpio_num = ENCODER_A_PIN;
+    config.ctrl_gpio_num = ENCODER_B_PIN;
+    config.channel = PCNT_CHANNEL_0;
+    config.unit = unit;
+    config.pos_mode = PCNT_COUNT_DEC;
+    config.neg_mode = PCNT_COUNT_INC;
+    config.lctrl_mode = PCNT_MODE_REVERSE;
+    config.hctrl_mode = PCNT_MODE_KEEP;
+    config.counter_h_lim = ENCODER_LIMIT;
+    config.counter_l_lim = -ENCODER_LIMIT;
+    pcnt_unit_config(&config);
+    config.pulse_gpio_num = ENCODER_B_PIN;
+    config.ctrl_gpio_num = ENCODER_A_PIN;
+    config.channel = PCNT_CHANNEL_1;
+    config.pos_mode = PCNT_COUNT_INC;
+    config.neg_mode = PCNT_COUNT_DEC;
+    pcnt_unit_config(&config);
+    pcnt_set_filter_value(unit, ENCODER_FILTER);
+    pcnt_filter_enable(unit);
+    pcnt_event_enable(unit, PCNT_EVT_H_LIM);
+    pcnt_event_enable(unit, PCNT_EVT_L_LIM);
+    pcnt_counter_pause(unit);
+    pcnt_counter_clear(unit);
+    pcnt_isr_service_install(0); // may already be installed
+    pcnt_isr_handler_add(unit, encoder_wrap, NULL);
+    pcnt_counter_resume(unit);
+}
+
+// counts since the last read, the wraps are read either side of the
+// counter so a wrap between them is seen
+int32_t encoder_read() {
+    int32_t before;
+    int16_t count;
+    do {
+        before = wraps;
+        pcnt_get_counter_value(unit, &count);
+    } while (before != wraps);
+    int32_t now = before + count;
+    int32_t counts = now - last;
+    last = now;
+    return counts;
+}
+#else
+static int32_t fed; // counts fed since the last read
+
+void encoder_start() { fed = 0; }
+
+int32_t encoder_read() {
+    int32_t counts = fed;
+    fed = 0;
+    return counts;
+}
+
+// the simulated encoder has moved
+void encoder_feed(int32_t counts) { fed += counts; }
+#endif
@@ -0,0 +1,25 @@
+// Rotary Table encoder input
+//
+// counts an external quadrature encoder on both edges of both channels
+// with an ESP32 PCNT unit, the 16 bit counter is extended by counting its
+// wraps in an interrupt so it can be read as counts since the last read,
+// in the simulator the counts are fed in by the test
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include <stdint.h>
+
+#define ENCODER_A_PIN 23    // channel A, SD card socket MOSI with no card
+#define ENCODER_B_PIN 5     // channel B, SD card socket CS with no card
+#define ENCODER_UNIT 7      // PCNT unit, clear of the FastAccelStepper ones
+#define ENCODER_LIMIT 16384 // counter wraps back to 0 at +/- this
+#define ENCODER_FILTER 100  // shortest pulse in 80MHz clocks
+
+void encoder_start();
+int32_t encoder_read();
+#if !defined(ARDUINO)
+void encoder_feed(int32_t counts);
+#endif
+
+#endif
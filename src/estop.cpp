@@ -0,0 +1,130 @@
+// Rotary Table emergency stop
+
+#include "estop.h"
+#include "motion_task.h"
+#include "step_trace.h"
+#include <atomic>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#include <soc/gpio_sig_map.h>
+#include <soc/gpio_struct.h>
+#endif
+
+static std::atomic<bool> tripped{false}; // stopped, not yet seen
+static int32_t cut_position[MOTION_AXES]; // step positions at the cut
+#if STEP_TRACE
+static uint32_t trip_time; // time of the edge
+#endif
+#if defined(ARDUINO)
+static uint8_t cut_pins[MOTION_AXES];     // step outputs
+static uint32_t cut_signals[MOTION_AXES]; // their peripheral outputs
+static std::atomic<bool> cut{false};      // step outputs held low
+#else
+static bool pressed; // simulated button
+#endif
+
+// the circuit has opened, hold every step output low where it is, take
+// the step position it was cut at and latch the stop for the motion task,
+// a bounce leaves the first cut be
+#if defined(ARDUINO)
+static void IRAM_ATTR estop_isr() {
+#if STEP_TRACE
+    trip_time = ESP.getCycleCount();
+#endif
+    if (!cut.load(std::memory_order_relaxed)) {
+        for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+            uint8_t pin = cut_pins[axis];
+            cut_signals[axis] = GPIO.func_out_sel_cfg[pin].val;
+            GPIO.out_w1tc = 1UL << pin;
+            GPIO.func_out_sel_cfg[pin].val = SIG_GPIO_OUT_IDX;
+            cut_position[axis] = steppers[axis]->getCurrentPosition();
+        }
+        cut.store(true, std::memory_order_relaxed);
+    }
+    tripped.store(true, std::memory_order_release);
+    motion_wake_from_isr();
+}
+#else
+void estop_edge() {
+    pressed = true;
+#if STEP_TRACE
+    trip_time = steppers[0]->now();
+#endif
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        steppers[axis]->cut = true;
+        cut_position[axis] = steppers[axis]->getCurrentPosition();
+    }
+    tripped.store(true, std::memory_order_release);
+}
+
+void estop_release() { pressed = false; }
+#endif
+
+// interrupt on the circuit opening, open at power up is a stop too
+void estop_start(const uint8_t *step_pins) {
+#if defined(ARDUINO) && ESTOP_PIN >= 0
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        cut_pins[axis] = step_pins[axis];
+    }
+    pinMode(ESTOP_PIN, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(ESTOP_PIN), estop_isr,
+                    ESTOP_ACTIVE == LOW ? FALLING : RISING);
+    if (estop_pressed()) {
+        tripped.store(true, std::memory_order_release);
+    }
+#else
+    (void)step_pins;
+#endif
+}
+
+// the circuit has opened since this was last asked
+bool estop_tripped() {
+    return tripped.exchange(false, std::memory_order_acquire);
+}
+
+// the step position of an axis as its output was cut, the stepper goes on
+// counting steps that don't reach the driver until it is stopped, or where
+// it is now for a stop without a cut
+int32_t estop_position(uint8_t axis) {
+#if defined(ARDUINO)
+    bool held = cut.load(std::memory_order_relaxed);
+#else
+    bool held = steppers[axis]->cut;
+#endif
+    return held ? cut_position[axis] : steppers[axis]->getCurrentPosition();
+}
+
+// the motion task has stopped the steppers, give them back their step
+// outputs, moving is set if any of them were moving at the edge
+void estop_restore(bool moving) {
+#if STEP_TRACE
+    if (moving) {
+        step_trace_stop(trip_time);
+    }
+#else
+    (void)moving;
+#endif
+#if defined(ARDUINO)
+    if (cut.load(std::memory_order_relaxed)) {
+        for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+            GPIO.func_out_sel_cfg[cut_pins[axis]].val = cut_signals[axis];
+        }
+        cut.store(false, std::memory_order_relaxed);
+    }
+#else
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        steppers[axis]->cut = false;
+    }
+#endif
+}
+
+// the circuit is still open
+bool estop_pressed() {
+#if defined(ARDUINO) && ESTOP_PIN >= 0
+    return digitalRead(ESTOP_PIN) == ESTOP_ACTIVE;
+#elif defined(ARDUINO)
+    return false;
+#else
+    return pressed;
+#endif
+}
@@ -0,0 +1,46 @@
+// Rotary Table emergency stop
+//
+// a normally closed stop circuit to ground on a pin of its own, pressing
+// the button or a broken wire opens it and the pull up takes the input
+// high, so the stop fails safe, and the pin isn't one the ESP32 reads at
+// power up
+//
+// the edge interrupts and the interrupt takes the step outputs off the
+// stepper peripheral in the gpio matrix and holds them low, so no further
+// steps reach the drivers and the stop doesn't wait on the motion task,
+// let alone the ui loop, it takes the step position of each stepper as it
+// cuts its output, then wakes the motion task, which stops the steppers at
+// those positions, as they count the steps made until then that never
+// reached the drivers, gives them back their step outputs, drops whatever
+// was driving them and raises an alarm that holds every move off until the
+// button is released and the alarm is cleared
+//
+// a stop this hard can leave a motor that was moving fast short of its
+// step position, encoder feedback puts that right when the alarm is
+// cleared, otherwise the axis is lost until it is homed or set again
+//
+// the step trace build times the stop from the edge to the last step
+//
+// in the simulator the test calls the edge and the release itself
+
+#ifndef ESTOP_H
+#define ESTOP_H
+
+#include <stdint.h>
+
+#ifndef ESTOP_PIN
+#define ESTOP_PIN 17 // stop circuit input, the blue led pad, -1 for none
+#endif
+#define ESTOP_ACTIVE HIGH // level of the input with the circuit open
+
+void estop_start(const uint8_t *step_pins);
+bool estop_tripped();
+int32_t estop_position(uint8_t axis);
+void estop_restore(bool moving);
+bool estop_pressed();
+#if !defined(ARDUINO)
+void estop_edge();
+void estop_release();
+#endif
+
+#endif
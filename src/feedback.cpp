@@ -0,0 +1,68 @@
+// Rotary Table encoder feedback
+
+#include "feedback.h"
+
+// ratio, with the sign on the steps
+static int64_t ratio_steps;  // steps for ratio_counts
+static int64_t ratio_counts; // encoder counts, more than 0
+static int64_t leftover;     // of the accumulator, in ratio_counts units
+static int64_t measured;     // position the encoder says in steps
+static bool active;          // the encoder is being followed
+
+// measure from a position, steps per counts of the encoder, backwards if
+// either is negative
+void feedback_start(int32_t steps, int32_t counts, int32_t position) {
+    if (counts < 0) {
+        counts = -counts;
+        steps = -steps;
+    }
+    ratio_steps = steps;
+    ratio_counts = counts;
+    leftover = 0;
+    measured = position;
+    active = counts != 0 && steps != 0;
+}
+
+// stop measuring
+void feedback_stop() { active = false; }
+
+// the position is being measured
+bool feedback_active() { return active; }
+
+// move the measured position by counts of the encoder, the leftover is
+// kept so it never drifts
+void feedback_input(int32_t counts) {
+    if (!active) {
+        return;
+    }
+    int64_t scaled = counts * ratio_steps + leftover;
+    int64_t moved = scaled / ratio_counts;
+    leftover = scaled % ratio_counts;
+    if (leftover < 0) {
+        leftover += ratio_counts;
+        moved--;
+    }
+    measured += moved;
+}
+
+// the stepper position has been moved without the motor moving
+void feedback_shift(int32_t steps) { measured += steps; }
+
+// steps the measured position is from a stepper position, lost steps
+// leave the motor short of it
+int32_t feedback_error(int32_t position) {
+    int64_t error = measured - position;
+    if (error > INT32_MAX) {
+        return INT32_MAX;
+    } else if (error < -INT32_MAX) {
+        return -INT32_MAX;
+    }
+    return error;
+}
+
+// steps of a count rounded up, errors this small are only the encoder
+// resolution
+int32_t feedback_resolution() {
+    int64_t steps = ratio_steps < 0 ? -ratio_steps : ratio_steps;
+    return (steps + ratio_counts - 1) / ratio_counts;
+}
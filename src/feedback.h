@@ -0,0 +1,29 @@
+// Rotary Table encoder feedback
+//
+// an optional encoder on the motor or worm shaft, on the same input as
+// the gearing encoder, is counted into a measured position in steps by a
+// ratio accumulator that keeps its remainder, the motion task compares it
+// with the stepper position so steps lost by a stalling motor are seen, a
+// few lost steps are put back at the end of a move and more than that is
+// an alarm, it is ahead of the backlash and the worm pitch error so it
+// sees nothing but the motor
+//
+// it only keeps the measured position, the motion task reads the encoder
+// and makes the checks
+
+#ifndef FEEDBACK_H
+#define FEEDBACK_H
+
+#include <stdint.h>
+
+#define FEEDBACK_CHECK_MS 50 // mS between checks during a move
+
+void feedback_start(int32_t steps, int32_t counts, int32_t position);
+void feedback_stop();
+bool feedback_active();
+void feedback_input(int32_t counts);
+void feedback_shift(int32_t steps);
+int32_t feedback_error(int32_t position);
+int32_t feedback_resolution();
+
+#endif
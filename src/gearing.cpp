@@ -0,0 +1,200 @@
+// Rotary Table electronic gearing
+
+#include "gearing.h"
+#include <math.h>
+
+#define GEAR_ONE 65536 // a step in the fixed point positions and speeds
+
+// ratio, with the sign on the steps
+static int64_t ratio_steps;  // steps for ratio_counts
+static int64_t ratio_counts; // encoder counts, more than 0
+static int64_t leftover;     // of the accumulator, in ratio_counts units
+
+// positions in 1/65536 steps from the start, speeds in 1/65536 steps per
+// slice
+static int64_t target;        // where the encoder says the axis should be
+static int64_t position;      // where the queued slices take it
+static int64_t speed;         // speed of the last slice
+static int64_t encoder_speed; // smoothed speed of the target
+static int64_t max_speed;     // fastest slice
+static int64_t max_accel;     // largest change from slice to slice
+static int64_t speed_moved;   // target moved since the last speed update
+static uint32_t speed_ticks;  // ticks between the counts it moved by
+static uint32_t count_ticks;  // ticks since the last count
+static uint32_t slice_ticks;  // ticks since the last speed update
+static bool active;           // slices are being made
+static bool stopping;         // slowing to a stop
+
+// whole steps of a fixed point position, rounded down
+static int64_t whole_steps(int64_t position) {
+    if (position < 0) {
+        return -((-position + GEAR_ONE - 1) / GEAR_ONE);
+    }
+    return position / GEAR_ONE;
+}
+
+// start following from where the axis is, steps per counts of the
+// encoder, at up to speed steps/s and accel steps/s^2
+void gear_start(int32_t steps, int32_t counts, uint32_t speed_limit,
+                uint32_t accel) {
+    if (counts < 0) {
+        counts = -counts;
+        steps = -steps;
+    }
+    ratio_steps = steps;
+    ratio_counts = counts;
+    leftover = 0;
+    target = 0;
+    position = 0;
+    speed = 0;
+    encoder_speed = 0;
+    speed_moved = 0;
+    speed_ticks = 0;
+    count_ticks = 0;
+    slice_ticks = 0;
+    max_speed = (int64_t)speed_limit * GEAR_ONE * GEAR_SLICE_TICKS /
+                TICKS_PER_S;
+    if (max_speed > (int64_t)GEAR_MAX_STEPS * GEAR_ONE) {
+        max_speed = (int64_t)GEAR_MAX_STEPS * GEAR_ONE;
+    }
+    // the slice is short so this is small, steps/s^2 * 2^16 / 250000,
+    // rounded up as a slow acceleration would lose most of itself
+    max_accel = ceil((double)accel * GEAR_ONE * GEAR_SLICE_TICKS /
+                     TICKS_PER_S * GEAR_SLICE_TICKS / TICKS_PER_S);
+    if (max_accel < 1) {
+        max_accel = 1;
+    }
+    active = counts != 0;
+    stopping = false;
+}
+
+// move the target by counts of the encoder over ticks, the leftover is
+// kept so the target never drifts, the encoder speed is updated once a
+// slice has gone by, from the counts since the last update over the time
+// from count to count, so a coarse encoder that counts less often than a
+// slice is measured over the time to its next count
+void gear_input(int32_t counts, uint32_t ticks) {
+    if (!active) {
+        return;
+    }
+    int64_t scaled = counts * ratio_steps * GEAR_ONE + leftover;
+    int64_t moved = scaled / ratio_counts;
+    leftover = scaled % ratio_counts;
+    if (leftover < 0) {
+        leftover += ratio_counts;
+        moved--;
+    }
+    target += moved;
+    speed_moved += moved;
+    count_ticks += ticks;
+    if (counts != 0) {
+        speed_ticks += count_ticks;
+        count_ticks = 0;
+    }
+    slice_ticks += ticks;
+    if (slice_ticks < GEAR_SLICE_TICKS) {
+        return;
+    }
+    slice_ticks = 0;
+    int64_t measured = 0;
+    int64_t span = GEAR_SLICE_TICKS; // time the measurement covers
+    if (speed_moved != 0 && speed_ticks != 0) {
+        measured = speed_moved * GEAR_SLICE_TICKS / speed_ticks;
+        span = speed_ticks;
+        speed_moved = 0;
+        speed_ticks = 0;
+    } else if (count_ticks >= GEAR_STILL_TICKS) {
+        count_ticks = GEAR_STILL_TICKS; // the next count is over this long
+    } else {
+        // the speed is held until the next count is twice as late as it
+        // says, then it is taken to have stopped
+        int64_t count = ratio_steps * GEAR_ONE / ratio_counts;
+        int64_t late = (encoder_speed < 0 ? -encoder_speed : encoder_speed) *
+                       count_ticks;
+        if (late <= 2 * (count < 0 ? -count : count) * GEAR_SLICE_TICKS) {
+            return;
+        }
+    }
+    if ((measured < 0 && encoder_speed > 0) ||
+        (measured > 0 && encoder_speed < 0)) {
+        // a reversal is taken at once, a coarse encoder would hold the
+        // old direction
+        encoder_speed = measured;
+        return;
+    }
+    // smoothed over GEAR_FILTER slices however long the measurement took,
+    // a coarse encoder is measured once a count
+    int64_t change = (measured - encoder_speed) * span /
+                     (GEAR_FILTER * GEAR_SLICE_TICKS);
+    if (span >= GEAR_FILTER * GEAR_SLICE_TICKS) {
+        change = measured - encoder_speed;
+    }
+    // the last of it too, or a stopped encoder leaves a creep
+    encoder_speed += change ? change : measured - encoder_speed;
+}
+
+// move the target by some steps, to take up backlash
+void gear_shift(int32_t steps) { target += (int64_t)steps * GEAR_ONE; }
+
+// stop following and slow down to a stop
+void gear_stop() { stopping = true; }
+
+// stop following with nothing more queued, the stepper has been stopped
+void gear_cancel() { active = false; }
+
+// make the next slice, the speed is the encoder speed with a part of the
+// lag added, no faster than it can stop at the target, and only changes
+// by the acceleration in a slice
+// returns false once it has stopped
+bool gear_next(stepper_command_s *command) {
+    if (!active) {
+        return false;
+    }
+    int64_t want = 0;
+    if (!stopping) {
+        int64_t lag = target - position;
+        int64_t catch_up = lag / GEAR_CATCH_SLICES;
+        if (catch_up == 0) {
+            catch_up = lag; // close the last of it
+        }
+        // slowing by half of max_accel a slice covers the lag and no more,
+        // the other half is left to follow an encoder that slows, an
+        // overshoot would cost a reversal and the backlash
+        double a = max_accel / 2.0;
+        double limit = (sqrt(a * a + 8.0 * a * (lag < 0 ? -lag : lag)) - a) / 2;
+        if (catch_up > limit) {
+            catch_up = limit;
+        } else if (catch_up < -limit) {
+            catch_up = -limit;
+        }
+        want = encoder_speed + catch_up;
+    } else if (speed == 0) {
+        active = false;
+        return false;
+    }
+    if (want > speed + max_accel) {
+        want = speed + max_accel;
+    } else if (want < speed - max_accel) {
+        want = speed - max_accel;
+    }
+    if (want > max_speed) {
+        want = max_speed;
+    } else if (want < -max_speed) {
+        want = -max_speed;
+    }
+    speed = want;
+    int32_t steps = whole_steps(position + speed) - whole_steps(position);
+    position += speed;
+    int32_t count = steps < 0 ? -steps : steps;
+    command->count_up = steps > 0;
+    command->steps = count;
+    // no steps is a pause of the same length
+    command->ticks = count ? GEAR_SLICE_TICKS / count : GEAR_SLICE_TICKS;
+    return true;
+}
+
+// slices are being made
+bool gear_active() { return active; }
+
+// whole steps the queued slices are behind the target
+int32_t gear_lag() { return whole_steps(target) - whole_steps(position); }
@@ -0,0 +1,51 @@
+// Rotary Table electronic gearing
+//
+// an axis follows an external quadrature encoder, such as the X scale of
+// the mill for helical work, at a ratio of steps to encoder counts
+//
+// the encoder counts are turned into a target position by a ratio
+// accumulator in 1/65536 steps that keeps its remainder, so the target is
+// exact however far the encoder moves, the stepper is fed a short slice
+// at a time through its raw queue at a speed that follows the encoder
+// speed and closes the lag, kept within the axis speed and acceleration,
+// so the lag stays bounded without a move being started for each change,
+// an encoder that counts less often than a slice has its speed measured
+// over the time between its counts and smoothed over the same time as a
+// fine one
+//
+// the lag is closed no faster than the axis can brake to a stop on the
+// target at half its acceleration, the other half is left to follow an
+// encoder that slows, so an encoder that speeds up and stops within the
+// acceleration of the axis is followed without going past it, one that
+// stops harder is gone past by the braking distance v^2/2a, and by as far
+// as it goes on in the slices queued ahead and those the smoothing takes
+// to see the stop, and come back to, so gearing wants an acceleration to
+// suit the encoder
+//
+// it only works out the steps, the motion task reads the encoder and
+// queues the slices
+
+#ifndef GEARING_H
+#define GEARING_H
+
+#include "motion_task.h"
+#include <stdint.h>
+
+#define GEAR_SLICE_TICKS 32000    // length of a queue entry, 2 mS
+#define GEAR_AHEAD_TICKS 64000    // queued ahead of the stepper
+#define GEAR_CATCH_SLICES 4       // slices to close the lag in
+#define GEAR_FILTER 4             // encoder speed smoothing, 1/n of each new
+#define GEAR_STILL_TICKS 16000000 // no count for this long is stopped, 1 S
+#define GEAR_MAX_STEPS 255        // most steps in a slice
+
+void gear_start(int32_t steps, int32_t counts, uint32_t speed,
+                uint32_t accel);
+void gear_input(int32_t counts, uint32_t ticks);
+void gear_shift(int32_t steps);
+void gear_stop();
+void gear_cancel();
+bool gear_next(stepper_command_s *command);
+bool gear_active();
+int32_t gear_lag();
+
+#endif
@@ -0,0 +1,68 @@
+// Rotary Table home switch
+
+#include "home.h"
+#include <atomic>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+static std::atomic<bool> armed{false};   // the next edge is latched
+static std::atomic<bool> latched{false}; // an edge has been latched
+static uint32_t latch_time;              // time of the edge in us
+
+// the time in us
+static uint32_t home_time() {
+#if defined(ARDUINO)
+    return micros();
+#else
+    return steppers[0]->now() / (TICKS_PER_S / 1000000);
+#endif
+}
+
+// the flag has reached the switch, latch the time of the edge once and
+// wake the motion task to take the position
+#if defined(ARDUINO)
+static void IRAM_ATTR home_isr() {
+#else
+void home_edge() {
+#endif
+    if (armed.exchange(false, std::memory_order_acquire)) {
+#if defined(ARDUINO)
+        latch_time = micros(); // in iram
+#else
+        latch_time = home_time();
+#endif
+        latched.store(true, std::memory_order_release);
+#if defined(ARDUINO)
+        motion_wake_from_isr();
+#endif
+    }
+}
+
+// interrupt on the active edge of the switch
+void home_start() {
+#if defined(ARDUINO) && HOME_PIN >= 0
+    pinMode(HOME_PIN, INPUT); // 34-39 have no pull ups, the sensor drives it
+    attachInterrupt(digitalPinToInterrupt(HOME_PIN), home_isr,
+                    HOME_ACTIVE == LOW ? FALLING : RISING);
+#endif
+}
+
+// latch the time of the next edge
+void home_arm() {
+    latched.store(false, std::memory_order_relaxed);
+    armed.store(true, std::memory_order_release);
+}
+
+// ignore the switch
+void home_disarm() { armed.store(false, std::memory_order_relaxed); }
+
+// the time since the edge in us
+// returns false if there has been no edge since it was armed
+bool home_latched(uint32_t *age) {
+    if (!latched.load(std::memory_order_acquire)) {
+        return false;
+    }
+    *age = home_time() - latch_time;
+    return true;
+}
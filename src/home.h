@@ -0,0 +1,39 @@
+// Rotary Table home switch
+//
+// an optical or hall sensor that a flag on the axis passes through, its
+// active edge interrupts and the interrupt notes the time of the edge and
+// wakes the motion task, which takes the step position at the edge as
+// where the stepper is less the steps it has made since at its speed, so
+// the home position is where the edge was and not where the stepper had
+// got to when the motion task next looked, the final approach is slow
+// enough that the task wakes before the next step and the position is on
+// the step the edge was at
+//
+// the interrupt reads nothing but the clock, the steppers are only asked
+// for their positions in the motion task
+//
+// in the simulator the test calls the edge itself as the axis passes the
+// flag
+
+#ifndef HOME_H
+#define HOME_H
+
+#include "motion_task.h"
+#include <stdint.h>
+
+#ifndef HOME_PIN
+#define HOME_PIN 35 // home switch input, P3 connector, -1 for none
+#endif
+#define HOME_ACTIVE LOW       // level of the input with the flag in it
+#define HOME_SLOW_SPEED 10000 // fastest final approach in steps per second
+#define HOME_SLOW_DIVISOR 10  // final approach is the speed / this
+
+void home_start();
+void home_arm();
+void home_disarm();
+bool home_latched(uint32_t *age);
+#if !defined(ARDUINO)
+void home_edge();
+#endif
+
+#endif
@@ -2,14 +2,26 @@
 
 #include "FastAccelStepper.h"
 #include "actions.h"
+#include "checkpoint.h"
+#include "encoder.h"
+#include "estop.h"
+#include "home.h"
+#include "motion.h"
+#include "pitch.h"
+#include "program.h"
 #include "screens.h"
+#include "serial.h"
+#include "settings.h"
+#include "step_trace.h"
+#include "tune.h"
 #include "ui.h"
 #include "vars.h"
 #include <Arduino.h>
-#include <Preferences.h>
 #include <TFT_eSPI.h>
 #include <XPT2046_Touchscreen.h>
-#include <cmath>
+#include <driver/gpio.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
 #include <lvgl.h>
 
 /*
@@ -34,55 +46,37 @@ rotation combinations for my ESP32-2432S028:
 #define XPT2046_MISO 39
 #define XPT2046_CLK 25
 #define XPT2046_CS 33
-#define GUI_UPDATE 10 // GUI update time in mS
+#define GUI_UPDATE 10   // GUI update time in mS while touched or moving
+#define IDLE_UPDATE 500 // longest GUI sleep in mS when nothing is happening
+#define UI_TASK_CORE 0  // ui core, the motion task has the other one
+#define ALARM_LOST 3    // motion_alarm shown while an axis is lost
 
 // local functions
 void touchpad_read(lv_indev_t *indev, lv_indev_data_t *data);
-void set_current_position();
-void set_jog_angles();
-void set_step_rate();
-void set_acceleration();
+void touch_isr();
+uint32_t tick_get();
+void ui_task(void *parameter);
+void set_division_buttons();
+#if STEP_TRACE
+void trace_write(const char *text);
+#endif
 
 // system variables
-int32_t current_division;       // current division
-int32_t current_position_steps; // current steps from zero degrees
-int32_t degrees_accel;          // acceleration in degrees per sec ^2
-int32_t degrees_per_sec;        // velocity in degrees per second
-int32_t division_direction = 1; // direction of divisions
-int32_t division_steps = 1;     // number of divisions
 int32_t entry_type;             // entry that is being edited
-int32_t jog_command;            // continouous jog command
-int32_t micro_steps;            // driver microstep setting
-int32_t required_steps;         // required steps for the move
-int32_t steps_per_rev;          // motor steps per motor revolution
-uint32_t circle_steps;          // steps in 360 degrees
-uint32_t currentMillis;         // track elapsed time
-uint32_t lastTick;              // tick timer for LVGL
-uint32_t previousMillis;        // last elapsed time
-float absolute_position;        // user defined position for absolute move
-float angle_per_step = 0;       // angle moved each step
-float current_position;         // current angular position, 0~360
-float degrees_per_rev;          // degrees table moves each motor revolution
-float division_start;           // start angle for division
-float division_end;             // end angle for division
-float division_angle = 360;     // angle of each division
-float jog_1_step;               // jog distance for 1 step
-float jog_10_steps;             // jog distance for 10 steps
-float jog_100_steps;            // jog distance for 100 steps
-float jog_1000_steps;           // jog distance for 1000 steps
-float relative_move;            // user defined relative move, 0~360
 ENTRY entries;                  // enum for entry type definitions
+TaskHandle_t ui_task_handle;    // woken by touches and motion changes
+int32_t pitch_point;            // pitch map point that is being edited
 
 // output pins are on CN1 connector
 #define dirPinStepper 27
 #define stepPinStepper 22
 
+// tilt axis output pins are on the SD card socket, with no card fitted
+#define dirPinTilt 19
+#define stepPinTilt 18
+
 // stepper engine
 FastAccelStepperEngine engine = FastAccelStepperEngine();
-FastAccelStepper *stepper = NULL;
-
-// non volatile storage for saving settings
-Preferences prefs;
 
 // display device
 lv_display_t *disp;
@@ -108,9 +102,12 @@ void setup() {
     touchscreen.begin(touchscreenSpi); // touchscreen init
     touchscreen.setRotation(
         TOUCH_ROTATION); // inverted landscape orientation to match screen
+    // replace the library touch interrupt with one that also wakes the ui
+    attachInterrupt(digitalPinToInterrupt(XPT2046_IRQ), touch_isr, FALLING);
 
     // initialise LVGL
     lv_init();
+    lv_tick_set_cb(tick_get); // LVGL reads the time rather than counting
     lv_display_t *disp; // display driver
     disp = lv_tft_espi_create(SCREEN_WIDTH, SCREEN_HEIGHT, draw_buf,
                               sizeof(draw_buf));
@@ -120,48 +117,27 @@ void setup() {
     lv_indev_set_mode(indev, LV_INDEV_MODE_EVENT); // we will manually callback
     lv_indev_set_read_cb(indev, touchpad_read);    // callback function
 
-    // initialize stepper
-    engine.init();
-    stepper = engine.stepperConnectToPin(stepPinStepper);
-    stepper->setDirectionPin(
+    // initialize steppers, their service task shares the motion core
+    engine.init(MOTION_TASK_CORE);
+    steppers[0] = engine.stepperConnectToPin(stepPinStepper);
+    steppers[0]->setDirectionPin(
         dirPinStepper,
         false); // changing to true will reverse stepper direction
+    steppers[1] = engine.stepperConnectToPin(stepPinTilt);
+    steppers[1]->setDirectionPin(dirPinTilt, false);
+#if TRIGGER_PIN >= 0
+    pinMode(TRIGGER_PIN, OUTPUT); // pulsed by division programs
+#endif
+#if STEP_TRACE
+    step_trace_start(stepPinStepper); // time every step pulse
+#endif
 
     // initialise EEZ Studio GUI
     ui_init();
 
-    // set some "reasonably sane" preferences if they don't exist
-    prefs.begin("myApp", false);
-    if (!prefs.isKey("relativeMove")) {
-        prefs.putFloat("relativeMove", 90);
-    }
-    if (!prefs.isKey("absolutePos")) {
-        prefs.putFloat("absolutePos", 90);
-    }
-    if (!prefs.isKey("stepsRev")) {
-        prefs.putInt("stepsRev", 200);
-    }
-    if (!prefs.isKey("degreesRev")) {
-        prefs.putFloat("degreesRev", 5);
-    }
-    if (!prefs.isKey("microSteps")) {
-        prefs.putInt("microSteps", 4);
-    }
-    if (!prefs.isKey("degSec")) {
-        prefs.putInt("degSec", 20);
-    }
-    if (!prefs.isKey("degAcc")) {
-        prefs.putInt("degAcc", 20);
-    }
-
-    // get saved preferences
-    relative_move = prefs.getFloat("relativeMove");
-    absolute_position = prefs.getFloat("absolutePos");
-    steps_per_rev = prefs.getInt("stepsRev");
-    degrees_per_rev = prefs.getFloat("degreesRev");
-    micro_steps = prefs.getInt("microSteps");
-    degrees_per_sec = prefs.getInt("degSec");
-    degrees_accel = prefs.getInt("degAcc");
+    // read the saved settings
+    settings_load();
+    pitch_update();
 
     // hide some kb buttons
     lv_buttonmatrix_set_button_ctrl(
@@ -178,49 +154,139 @@ void setup() {
     lv_obj_add_state(objects.btn_division_prev, LV_STATE_DISABLED);
     lv_obj_add_state(objects.btn_division_next, LV_STATE_DISABLED);
 
-    // finalize setup
-    angle_per_step = degrees_per_rev / steps_per_rev / micro_steps;
-    circle_steps = 360.0 / angle_per_step + 0.5;
-    required_steps = relative_move / angle_per_step + 0.5;
-    set_jog_angles();
+    // finalize setup, the screens start on the table
+    motion_select_axis(0);
+    required_steps = angle_to_steps(relative_move);
     set_acceleration();
+    set_jerk();
     set_step_rate();
+    set_backlash();
+    // carry on from where the table was before a power cycle
+    uint8_t restored = checkpoint_load();
+    if (restored == CHECKPOINT_EXACT) {
+        Serial.print(" - position restored");
+    } else if (restored == CHECKPOINT_MOVING) {
+        Serial.print(" - position restored from before a move, home it");
+    }
+    // count the encoder for electronic gearing or feedback
+    encoder_start();
+    set_feedback();
+    // latch the home switch edge
+    home_start();
+    // cut the step outputs from the emergency stop interrupt
+    static const uint8_t step_pins[MOTION_AXES] = {stepPinStepper,
+                                                   stepPinTilt};
+    estop_start(step_pins);
+
+    // start the motion and ui tasks on their own cores, the serial task
+    // shares the ui core
+    motion_task_start();
+    xTaskCreatePinnedToCore(ui_task, "ui", 8192, NULL, 1, &ui_task_handle,
+                            UI_TASK_CORE);
+    motion_notify_task(ui_task_handle);
+    serial_notify_task(ui_task_handle);
+    serial_task_start();
+
+#if CONFIG_PM_ENABLE
+    // let the cpu slow down and sleep while both tasks are waiting, the
+    // motion task holds off light sleep while the stepper is running
+    esp_pm_config_esp32_t pm_config = {
+        .max_freq_mhz = 240,
+        .min_freq_mhz = 80,
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+        .light_sleep_enable = true,
+#endif
+    };
+    esp_pm_configure(&pm_config);
+    // a touch wakes the cpu from light sleep
+    gpio_wakeup_enable((gpio_num_t)XPT2046_IRQ, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+#endif
 
     // setup is complete
     Serial.println(" - setup complete");
 }
 
-void loop() {
-    currentMillis = millis();
-    if (currentMillis - previousMillis >= GUI_UPDATE) {
-        previousMillis = currentMillis;
-        lv_tick_inc(millis() - lastTick); // update the LVGL tick timer
-        lastTick = millis();
-        lv_timer_handler(); // update the LVGL UI
+// the work is done by the ui and motion tasks
+void loop() { vTaskDelete(NULL); }
+
+// LVGL and the EEZ GUI only run in this task, it sleeps until the next
+// LVGL timer is due, the screen is touched or the stepper starts or stops
+void ui_task(void *parameter) {
+    motion_status_t status;
+    bool was_program = false;
+    uint32_t shown_program = program_version();
+#if STEP_TRACE
+    bool was_running = false;
+#endif
+    for (;;) {
+        uint32_t wait = lv_timer_handler(); // update the LVGL UI
         set_current_position();
+        // store the rates a tuning run found
+        if (tune_service()) {
+            settings_changed();
+        }
+        bool serial_waiting = serial_service(); // run serial commands
+        settings_service();   // save any changed settings
+        checkpoint_service(); // save the position once it settles
+        // a division program has finished or a program has been loaded
+        if ((was_program && !motion_program_running()) ||
+            shown_program != program_version()) {
+            set_division_buttons();
+            shown_program = program_version();
+        }
+        was_program = motion_program_running();
         ui_tick();            // update EEZ GUI
         lv_indev_read(indev); // read touchpad data
+        // keep updating while touched to catch the release, while moving,
+        // running a program or tuning to show the position, and while
+        // serial commands wait for room in the program
+        motion_get_status(&status);
+#if STEP_TRACE
+        // read the step times before the ring fills, report each move
+        step_trace_service();
+        if (was_running && !status.running) {
+            step_trace_end(trace_write);
+        }
+        was_running = status.running;
+#endif
+        if (touchscreen.tirqTouched() || status.running || status.program ||
+            was_program || tune_active() || serial_waiting) {
+            if (wait > GUI_UPDATE) {
+                wait = GUI_UPDATE;
+            }
+        } else if (wait > IDLE_UPDATE) {
+            wait = IDLE_UPDATE;
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(wait));
     }
 }
 
-void set_current_position() {
-    double integer_part;
-    double fractional_part = std::modf(
-        stepper->getCurrentPosition() * angle_per_step / 360, &integer_part);
-    double angle = 360 * fractional_part;
-    if (angle < 0) {
-        current_position = 360 + angle;
-    } else {
-        current_position = angle;
+#if STEP_TRACE
+// step trace reports go out on the serial port
+void trace_write(const char *text) { Serial.print(text); }
+#endif
+
+// LVGL tick source
+uint32_t tick_get() { return millis(); }
+
+// touch interrupt, flag the touch for the touchscreen library and wake
+// the ui task
+void IRAM_ATTR touch_isr() {
+    BaseType_t woken = pdFALSE;
+    touchscreen.isrWake = true;
+    if (ui_task_handle) {
+        vTaskNotifyGiveFromISR(ui_task_handle, &woken);
+    }
+    if (woken) {
+        portYIELD_FROM_ISR();
     }
 }
 
-// read the touchpad
+// read the touchpad, touches are read while the axes move too and the
+// actions decide with motion_input() what they can do
 void touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
-    // inhibit touchpad if motion is active except if the motion is a continuous
-    // jog
-    if (touchscreen.tirqTouched() && touchscreen.touched() &&
-        (!stepper->isRunning() || jog_command)) {
+    if (touchscreen.tirqTouched() && touchscreen.touched()) {
         TS_Point p = touchscreen.getPoint();
         // map touchscreen points to the correct width and height
         data->point.x = map(p.x, 200, 3700, 1, SCREEN_WIDTH);
@@ -231,57 +297,11 @@ void touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
     }
 }
 
-// smallest jog available is one step
-// so keep it simple and use some step multiples
-void set_jog_angles() {
-    jog_1_step = angle_per_step * 1;
-    jog_10_steps = angle_per_step * 10;
-    jog_100_steps = angle_per_step * 100;
-    jog_1000_steps = angle_per_step * 1000;
-}
-
-void set_step_rate() {
-    float steps_per_degree = 1 / angle_per_step;
-    float steps_per_sec = degrees_per_sec * steps_per_degree;
-    stepper->setSpeedInHz(steps_per_sec);
-}
-
-void set_acceleration() {
-    float steps_per_degree = 1 / angle_per_step;
-    float steps = degrees_accel * steps_per_degree;
-    stepper->setAcceleration(steps);
-}
-
-// fixes angle for final division move
-float fix_angle(float angle) {
-    if (angle > 180) {
-        angle -= 360;
-    } else if (angle < -180) {
-        angle += 360;
-    } else if (angle == 0) {
-        angle = 360;
-    }
-    return angle;
-}
-
 void action_goto_zero(lv_event_t *e) {
     int32_t dir = (int32_t)lv_event_get_user_data(e);
-    float angle;
-    // positive direction
-    if (dir == 1) {
-        angle = 360.0 - current_position;
-        // negative direction
-    } else {
-        angle = current_position * -1;
-    }
-    // different rounding dependent on direction
-    if (angle < 0) {
-        required_steps = angle / angle_per_step - 0.5;
-    } else {
-        required_steps = angle / angle_per_step + 0.5;
+    if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        motion_goto_zero(dir);
     }
-    // do the move
-    stepper->move(required_steps);
 }
 
 // this function handles:
@@ -289,112 +309,49 @@ void action_goto_zero(lv_event_t *e) {
 //    goto division start (2)
 void action_absolute_move(lv_event_t *e) {
     int32_t dir = (int32_t)lv_event_get_user_data(e);
-    float angle;
-    // positive direction
-    if (dir > 0) {
-        // absolute move
-        if (dir == 1) {
-            angle = absolute_position - current_position;
-            // goto division start
-        } else {
-            angle = division_start - current_position;
-            current_division == 0;
-            lv_obj_clear_state(objects.btn_division_next, LV_STATE_DISABLED);
-            lv_obj_add_state(objects.btn_division_prev, LV_STATE_DISABLED);
-        }
-        if (angle <
-            jog_1_step) { // should be <= 0 but we allow for rounding errors
-            angle = 360 + angle;
-        }
-        // negative direction
-    } else if (dir < 0) {
-        // absolute move
-        if (dir == -1) {
-            angle = absolute_position - current_position - 360;
-            // goto division start
-        } else {
-            angle = division_start - current_position - 360;
-            current_division == 0;
-            lv_obj_clear_state(objects.btn_division_next, LV_STATE_DISABLED);
-            lv_obj_add_state(objects.btn_division_prev, LV_STATE_DISABLED);
-        }
-        if (angle < -360) {
-            angle = 360 + angle;
-        }
-        // invalid direction
-    } else {
+    if (motion_input(INPUT_OTHER) != INPUT_NOW) {
         return;
     }
-    // different rounding dependent on direction
-    if (angle < 0) {
-        required_steps = angle / angle_per_step - 0.5;
-    } else {
-        required_steps = angle / angle_per_step + 0.5;
+    // goto division start resets the divisions
+    if (dir == 2 || dir == -2) {
+        lv_obj_clear_state(objects.btn_division_next, LV_STATE_DISABLED);
+        lv_obj_add_state(objects.btn_division_prev, LV_STATE_DISABLED);
     }
-    // do the move
-    stepper->move(required_steps);
+    motion_absolute_move(dir);
 }
 
 void action_relative_move(lv_event_t *e) {
     int32_t dir = (int32_t)lv_event_get_user_data(e);
-    // doesn't seem to need different rounding dependent on direction ???
-    required_steps = (relative_move / angle_per_step + 0.5) * dir;
-    stepper->move(required_steps);
+    if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        motion_relative_move(dir);
+    }
 }
 
 void action_goto_division(lv_event_t *e) {
-    // due to rounding errors, the final move is to the entered
-    // position rather than the next calculated division move
     int32_t division_type =
         (uint32_t)lv_event_get_user_data(e); // 1=next, -1=previous
-    int32_t dir;
-    float angle;
-    // determine the direction
-    if (division_type == 1 && current_division != division_steps) {
-        current_division++;
-        dir = division_direction;
-    } else if (division_type == -1 && current_division != 0) {
-        current_division--;
-        dir = division_direction * -1;
-    } else {
+    // queued behind a division move in progress
+    if (!motion_goto_division(division_type)) {
         return;
     }
-    // final negative move
-    if (current_division == 0 && division_type == -1 && division_steps > 1) {
-        if (division_direction == 1) {
-            angle = current_position - abs(division_start);
-        } else if (division_direction == -1) {
-            angle = abs(division_start) - current_position;
-        }
-        angle = fix_angle(angle);
-        angle *= dir;
-        // final positive move
-    } else if (current_division == division_steps && division_type == 1 &&
-               division_steps > 1) {
-        if (division_direction == 1) {
-            angle = abs(division_end) - current_position;
-        } else if (division_direction == -1) {
-            angle = current_position - abs(division_end);
-        }
-        angle = fix_angle(angle);
-        angle *= dir;
-        // intermediate division move
-    } else {
-        angle = (abs(division_angle) / division_steps) * dir;
-    }
-    // different rounding dependent on direction
-    if (dir == -1) {
-        required_steps = angle / angle_per_step - 0.5;
-    } else {
-        required_steps = angle / angle_per_step + 0.5;
+    set_division_buttons();
+}
+
+// run the rest of the division cycle without stopping for the ui
+void action_run_divisions(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) != INPUT_NOW || !motion_run_divisions()) {
+        return;
     }
-    // do the move
-    stepper->move(required_steps);
-    // set next and previous buttons state
+    lv_obj_add_state(objects.btn_division_next, LV_STATE_DISABLED);
+    lv_obj_add_state(objects.btn_division_prev, LV_STATE_DISABLED);
+}
+
+// set next and previous buttons state
+void set_division_buttons() {
     if (current_division == 0) {
         lv_obj_clear_state(objects.btn_division_next, LV_STATE_DISABLED);
         lv_obj_add_state(objects.btn_division_prev, LV_STATE_DISABLED);
-    } else if (current_division == division_steps) {
+    } else if (current_division == division_count()) {
         lv_obj_add_state(objects.btn_division_next, LV_STATE_DISABLED);
         lv_obj_clear_state(objects.btn_division_prev, LV_STATE_DISABLED);
     } else {
@@ -403,20 +360,18 @@ void action_goto_division(lv_event_t *e) {
     }
 }
 
+// a jog can change direction as it moves and its release stops it, the
+// stop button stops anything
 void action_jog_continuous(lv_event_t *e) {
-    // stop the jog
-    if (jog_command == 0) {
-        stepper->stopMove();
-        // jog in positive direction
-    } else if (jog_command == 1) {
-        stepper->runForward();
-        // jog in negative direction
-    } else if (jog_command == -1) {
-        stepper->runBackward();
+    if (motion_input(jog_command ? INPUT_JOG : INPUT_STOP) == INPUT_NOW) {
+        motion_jog_continuous(jog_command);
     }
 }
 
 void action_jog_incremental(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) != INPUT_NOW) {
+        return;
+    }
     lv_obj_t *obj = (lv_obj_t *)lv_event_get_target(e);
     lv_obj_t *lbl = lv_obj_get_child(obj, 0);
     // a kludgy way to get a float from the label text
@@ -425,17 +380,91 @@ void action_jog_incremental(lv_event_t *e) {
     str.replace("\n", "");
     const char *cStr = str.c_str();
     float value = atof(cStr);
-    // different rounding dependent on direction
-    if (value < 0) {
-        required_steps = value / angle_per_step - 0.5;
+    motion_jog_incremental(value);
+}
+
+void action_set_zero(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        motion_set_zero();
+    }
+}
+
+// the jog and division screens move the axis in the user data, it can
+// only be changed while everything is stopped
+void action_select_axis(lv_event_t *e) {
+    int32_t axis = (int32_t)lv_event_get_user_data(e);
+    if (axis < 0 || axis >= MOTION_AXES ||
+        motion_input(INPUT_OTHER) != INPUT_NOW) {
+        return;
+    }
+    motion_select_axis(axis);
+    set_division_buttons();
+}
+
+// start a milling run forward (1) or backward (-1), or end it at the
+// next mill end (0)
+void action_mill(lv_event_t *e) {
+    int32_t dir = (int32_t)lv_event_get_user_data(e);
+    if (dir == 0) {
+        if (motion_input(INPUT_MILL_END) == INPUT_NOW) {
+            motion_mill_end();
+        }
+    } else if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        motion_mill(dir);
+    }
+}
+
+// change the feed override by the user data percent while milling, 0
+// goes back to 100%
+void action_feed_override(lv_event_t *e) {
+    int32_t change = (int32_t)lv_event_get_user_data(e);
+    if (motion_input(INPUT_OVERRIDE) != INPUT_NOW) {
+        return;
+    }
+    if (change == 0) {
+        feed_override = 100;
     } else {
-        required_steps = value / angle_per_step + 0.5;
+        feed_override += change;
+    }
+    if (feed_override > MAX_OVERRIDE) {
+        feed_override = MAX_OVERRIDE;
+    } else if (feed_override < MIN_OVERRIDE) {
+        feed_override = MIN_OVERRIDE;
+    }
+    set_feed_override();
+}
+
+// follow the encoder (1) or stop following it (0)
+void action_gear(lv_event_t *e) {
+    int32_t follow = (int32_t)lv_event_get_user_data(e);
+    if (motion_input(follow ? INPUT_OTHER : INPUT_GEAR_STOP) == INPUT_NOW) {
+        motion_gear(follow);
+    }
+}
+
+// home the selected axis seeking forward (1) or backward (-1)
+void action_home(lv_event_t *e) {
+    int32_t dir = (int32_t)lv_event_get_user_data(e);
+    if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        motion_home(dir);
+    }
+}
+
+// clear a latched alarm, the table position is then where the encoder
+// measured it, an emergency stop stays latched while the button is held
+void action_clear_alarm(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        motion_post(MOTION_CLEAR_ALARM);
     }
-    // do the move
-    stepper->move(required_steps);
 }
 
-void action_set_zero(lv_event_t *e) { stepper->setCurrentPosition(0); }
+// find the fastest speed and acceleration of the selected axis, the
+// stop button gives up and leaves them as they were
+void action_tune(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) == INPUT_NOW) {
+        tune_start();
+    }
+}
 
 // hide keyboard decimal point
 void action_decimal_hide(lv_event_t *e) {
@@ -453,8 +482,12 @@ void action_decimal_show(lv_event_t *e) {
         (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
 }
 
-// get the entry input, convert it to a float, then save it
+// get the entry input, convert it to a float, then save it, settings are
+// only changed with the axes stopped
 void action_get_input_float(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) != INPUT_NOW) {
+        return;
+    }
     float entry = atof(lv_textarea_get_text(objects.entry_input));
     float angle;
     float degrees;
@@ -467,8 +500,8 @@ void action_get_input_float(lv_event_t *e) {
         } else {
             angle = entry;
         }
-        relative_move = angle;
-        prefs.putFloat("relativeMove", angle);
+        relative_move = degrees_to_angle(angle);
+        settings_changed();
         // set degrees per rev
     } else if (entry_type == ENTRY_DEGREES_PER_REV) {
         if (entry > 360) {
@@ -479,27 +512,42 @@ void action_get_input_float(lv_event_t *e) {
             degrees = entry;
         }
         degrees_per_rev = degrees;
-        prefs.putFloat("degreesRev", degrees);
-        // save current angle
-        float tmp = stepper->getCurrentPosition();
-        angle_per_step = degrees_per_rev / steps_per_rev / micro_steps;
-        // restore current angle
-        stepper->setCurrentPosition(tmp / angle_per_step);
-        set_jog_angles();
+        settings_changed();
+        set_drive(); // keeps the current angle
     } else if (entry_type == ENTRY_ABSOLUTE_POSITION) {
         if (entry >= 360) {
             angle = 360;
-        } else if (angle < 0) {
+        } else if (entry < 0) {
+            angle = 0;
+        } else {
+            angle = entry;
+        }
+        absolute_position = degrees_to_angle(angle);
+        settings_changed();
+        // set the angle milling runs end at
+    } else if (entry_type == ENTRY_MILL_END) {
+        if (entry >= 360) {
+            angle = 360;
+        } else if (entry < 0) {
+            angle = 0;
+        } else {
+            angle = entry;
+        }
+        mill_end = degrees_to_angle(angle);
+        // set the angle of the home switch edge
+    } else if (entry_type == ENTRY_HOME_OFFSET) {
+        if (entry >= 360) {
+            angle = 360;
+        } else if (entry < 0) {
             angle = 0;
         } else {
             angle = entry;
         }
-        absolute_position = angle;
-        prefs.putFloat("absolutePos", angle);
+        home_offset = degrees_to_angle(angle);
+        settings_changed();
         // set division start or division end
     } else if (entry_type == ENTRY_DIVISION_START ||
                entry_type == ENTRY_DIVISION_END) {
-        division_direction = 1;
         if (entry >= 360) {
             angle = 360;
         } else if (entry < -360) {
@@ -508,30 +556,21 @@ void action_get_input_float(lv_event_t *e) {
             angle = entry;
         }
         if (entry_type == ENTRY_DIVISION_START) {
-            division_start = angle;
+            division_start = degrees_to_angle(angle);
         } else {
             lv_buttonmatrix_set_button_ctrl(
                 objects.entry_kb, 12,
                 (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
-            division_end = angle;
+            // a negative end angle divides in the negative direction
             if (angle < 0) {
                 division_direction = -1;
+                division_end = degrees_to_angle(-angle);
+            } else {
+                division_direction = 1;
+                division_end = degrees_to_angle(angle);
             }
         }
-        if (angle >= 0) {
-            angle = abs(division_end) - division_start;
-        } else {
-            angle = division_start - abs(division_end);
-        }
-        if (angle < 0) {
-            angle += 360;
-        } else if (angle == 0) {
-            angle = 360;
-        }
-        if (division_end < 0) {
-            angle *= -1;
-        }
-        division_angle = angle;
+        set_division_angle();
     }
 }
 
@@ -539,26 +578,34 @@ void action_get_input_float(lv_event_t *e) {
 void action_set_input_float(lv_event_t *e) {
     char value[9] = "";
     if (entry_type == ENTRY_RELATIVE_MOVE) {
-        dtostrf(relative_move, 0, 3, value);
+        dtostrf(angle_to_degrees(relative_move), 0, 3, value);
     } else if (entry_type == ENTRY_DEGREES_PER_REV) {
         dtostrf(degrees_per_rev, 0, 3, value);
     } else if (entry_type == ENTRY_DIVISION_START) {
-        dtostrf(division_start, 0, 3, value);
+        dtostrf(angle_to_degrees(division_start), 0, 3, value);
     } else if (entry_type == ENTRY_DIVISION_END) {
         // show +/- key for division rotation direction
         lv_buttonmatrix_clear_button_ctrl(
             objects.entry_kb, 12,
             (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
-        dtostrf(division_end, 0, 3, value);
+        dtostrf(get_var_division_end(), 0, 3, value);
     } else if (entry_type == ENTRY_ABSOLUTE_POSITION) {
-        dtostrf(absolute_position, 0, 3, value);
+        dtostrf(angle_to_degrees(absolute_position), 0, 3, value);
+    } else if (entry_type == ENTRY_MILL_END) {
+        dtostrf(angle_to_degrees(mill_end), 0, 3, value);
+    } else if (entry_type == ENTRY_HOME_OFFSET) {
+        dtostrf(angle_to_degrees(home_offset), 0, 3, value);
     }
     // display the value
     lv_textarea_set_text(objects.entry_input, value);
 }
 
-// get the entry input, convert it to a int, then save it
+// get the entry input, convert it to a int, then save it, settings are
+// only changed with the axes stopped
 void action_get_input_int(lv_event_t *e) {
+    if (motion_input(INPUT_OTHER) != INPUT_NOW) {
+        return;
+    }
     int entry = atoi(lv_textarea_get_text(objects.entry_input));
     int steps;
     int degrees;
@@ -572,13 +619,8 @@ void action_get_input_int(lv_event_t *e) {
             steps = entry;
         }
         steps_per_rev = steps;
-        prefs.putInt("stepsRev", steps);
-        // save current angle
-        float tmp = stepper->getCurrentPosition();
-        angle_per_step = degrees_per_rev / steps_per_rev / micro_steps;
-        // restore current angle
-        stepper->setCurrentPosition(tmp / angle_per_step);
-        set_jog_angles();
+        settings_changed();
+        set_drive(); // keeps the current angle
         // set microsteps
     } else if (entry_type == ENTRY_MICROSTEPS) {
         if (entry > 256) {
@@ -589,13 +631,8 @@ void action_get_input_int(lv_event_t *e) {
             steps = entry;
         }
         micro_steps = steps;
-        prefs.putInt("microSteps", steps);
-        // save current angle
-        float tmp = stepper->getCurrentPosition();
-        angle_per_step = degrees_per_rev / steps_per_rev / micro_steps;
-        // restore current angle
-        stepper->setCurrentPosition(tmp / angle_per_step);
-        set_jog_angles();
+        settings_changed();
+        set_drive(); // keeps the current angle
         // set velocity in degrees per second
     } else if (entry_type == ENTRY_DEGREES_PER_SEC) {
         if (entry > 100) {
@@ -606,7 +643,7 @@ void action_get_input_int(lv_event_t *e) {
             degrees = entry;
         }
         degrees_per_sec = degrees;
-        prefs.putInt("degSec", degrees);
+        settings_changed();
         set_step_rate();
         set_jog_angles();
         // set acceleration in degrees per second ^2
@@ -619,24 +656,143 @@ void action_get_input_int(lv_event_t *e) {
             degrees = entry;
         }
         degrees_accel = degrees;
-        prefs.putInt("degAcc", degrees);
+        settings_changed();
         set_acceleration();
+        // set jerk in degrees per second ^3, 0 for none
+    } else if (entry_type == ENTRY_DEGREES_JERK) {
+        if (entry > 1000000) {
+            degrees = 1000000;
+        } else if (entry < 0) {
+            degrees = 0;
+        } else {
+            degrees = entry;
+        }
+        degrees_jerk = degrees;
+        settings_changed();
+        set_jerk();
         // set division steps
     } else if (entry_type == ENTRY_DIVISION_STEPS) {
-        if (entry > 999) {
-            steps = 999;
+        if (entry > MAX_DIVISIONS) {
+            steps = MAX_DIVISIONS;
         } else if (entry < 1) {
             steps = 1;
         } else {
             steps = entry;
         }
         division_steps = steps;
+        // set division dwell
+    } else if (entry_type == ENTRY_DIVISION_DWELL) {
+        if (entry > MAX_DWELL) {
+            steps = MAX_DWELL;
+        } else if (entry < 0) {
+            steps = 0;
+        } else {
+            steps = entry;
+        }
+        division_dwell = steps;
+        settings_changed();
+        // set backlash steps
+    } else if (entry_type == ENTRY_BACKLASH) {
+        if (entry > MAX_BACKLASH) {
+            steps = MAX_BACKLASH;
+        } else if (entry < 0) {
+            steps = 0;
+        } else {
+            steps = entry;
+        }
+        backlash_steps = steps;
+        settings_changed();
+        set_backlash();
+        // set approach direction, 1, -1 or 0 for either
+    } else if (entry_type == ENTRY_APPROACH) {
+        lv_buttonmatrix_set_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        if (entry > 0) {
+            steps = 1;
+        } else if (entry < 0) {
+            steps = -1;
+        } else {
+            steps = 0;
+        }
+        approach_direction = steps;
+        settings_changed();
+        set_backlash();
+        // select a pitch map point
+    } else if (entry_type == ENTRY_PITCH_POINT) {
+        if (entry > PITCH_POINTS - 1) {
+            steps = PITCH_POINTS - 1;
+        } else if (entry < 0) {
+            steps = 0;
+        } else {
+            steps = entry;
+        }
+        pitch_point = steps;
+        // set the pitch error at the point in arc seconds
+    } else if (entry_type == ENTRY_PITCH_ERROR) {
+        lv_buttonmatrix_set_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        if (entry > PITCH_MAX_ERROR) {
+            steps = PITCH_MAX_ERROR;
+        } else if (entry < -PITCH_MAX_ERROR) {
+            steps = -PITCH_MAX_ERROR;
+        } else {
+            steps = entry;
+        }
+        pitch_map[pitch_point] = steps;
+        settings_changed();
+        pitch_update();
+        // set the whole turns of a milling run, 0 runs on
+    } else if (entry_type == ENTRY_MILL_TURNS) {
+        if (entry > MAX_MILL_TURNS) {
+            steps = MAX_MILL_TURNS;
+        } else if (entry < 0) {
+            steps = 0;
+        } else {
+            steps = entry;
+        }
+        mill_turns = steps;
+        // set the encoder counts for a turn of the axis when gearing
+    } else if (entry_type == ENTRY_GEAR_COUNTS) {
+        lv_buttonmatrix_set_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        if (entry > MAX_GEAR_COUNTS) {
+            steps = MAX_GEAR_COUNTS;
+        } else if (entry < -MAX_GEAR_COUNTS) {
+            steps = -MAX_GEAR_COUNTS;
+        } else {
+            steps = entry;
+        }
+        gear_counts = steps;
+        // set the encoder counts for a turn of the table, 0 for no feedback
+    } else if (entry_type == ENTRY_FEEDBACK_COUNTS) {
+        lv_buttonmatrix_set_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        if (entry > MAX_GEAR_COUNTS) {
+            steps = MAX_GEAR_COUNTS;
+        } else if (entry < -MAX_GEAR_COUNTS) {
+            steps = -MAX_GEAR_COUNTS;
+        } else {
+            steps = entry;
+        }
+        feedback_counts = steps;
+        settings_changed();
+        set_feedback();
+        // load a stored program, 0 for evenly spaced divisions
+    } else if (entry_type == ENTRY_PROGRAM) {
+        if (entry < 1 || entry > PROGRAM_SLOTS || !program_load(entry)) {
+            program_unload();
+        }
+        set_division_buttons();
     }
 }
 
 // convert a int to a char, then display it in the entry input
 void action_set_input_int(lv_event_t *e) {
-    char value[7] = "";
+    char value[8] = "";
     if (entry_type == ENTRY_STEPS_PER_REV) {
         sprintf(value, "%i", steps_per_rev);
     } else if (entry_type == ENTRY_MICROSTEPS) {
@@ -645,8 +801,44 @@ void action_set_input_int(lv_event_t *e) {
         sprintf(value, "%i", degrees_per_sec);
     } else if (entry_type == ENTRY_DEGREES_ACCEL) {
         sprintf(value, "%i", degrees_accel);
+    } else if (entry_type == ENTRY_DEGREES_JERK) {
+        sprintf(value, "%i", degrees_jerk);
     } else if (entry_type == ENTRY_DIVISION_STEPS) {
         sprintf(value, "%i", division_steps);
+    } else if (entry_type == ENTRY_DIVISION_DWELL) {
+        sprintf(value, "%i", division_dwell);
+    } else if (entry_type == ENTRY_BACKLASH) {
+        sprintf(value, "%i", backlash_steps);
+    } else if (entry_type == ENTRY_APPROACH) {
+        // show +/- key for the approach direction
+        lv_buttonmatrix_clear_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        sprintf(value, "%i", approach_direction);
+    } else if (entry_type == ENTRY_PITCH_POINT) {
+        sprintf(value, "%i", pitch_point);
+    } else if (entry_type == ENTRY_PITCH_ERROR) {
+        // show +/- key for the pitch error
+        lv_buttonmatrix_clear_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        sprintf(value, "%i", pitch_map[pitch_point]);
+    } else if (entry_type == ENTRY_MILL_TURNS) {
+        sprintf(value, "%i", mill_turns);
+    } else if (entry_type == ENTRY_GEAR_COUNTS) {
+        // show +/- key for the gearing direction
+        lv_buttonmatrix_clear_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        sprintf(value, "%i", gear_counts);
+    } else if (entry_type == ENTRY_FEEDBACK_COUNTS) {
+        // show +/- key for the encoder direction
+        lv_buttonmatrix_clear_button_ctrl(
+            objects.entry_kb, 12,
+            (lv_buttonmatrix_ctrl_t)LV_BUTTONMATRIX_CTRL_HIDDEN);
+        sprintf(value, "%i", feedback_counts);
+    } else if (entry_type == ENTRY_PROGRAM) {
+        sprintf(value, "%i", program_slot);
     }
     // display the value
     lv_textarea_set_text(objects.entry_input, value);
@@ -657,47 +849,127 @@ void action_set_input_int(lv_event_t *e) {
 ENTRY get_var_entries() { return entries; }
 void set_var_entries(ENTRY value) { entries = value; }
 
+int32_t get_var_approach_direction() { return approach_direction; }
+void set_var_approach_direction(int32_t value) { approach_direction = value; }
+
+int32_t get_var_backlash_steps() { return backlash_steps; }
+void set_var_backlash_steps(int32_t value) { backlash_steps = value; }
+
 int32_t get_var_current_division() { return current_division; }
 void set_var_current_division(int32_t value) { current_division = value; }
 
 int32_t get_var_degrees_accel() { return degrees_accel; }
 void set_var_degrees_accel(int32_t value) { degrees_accel = value; }
 
+int32_t get_var_degrees_jerk() { return degrees_jerk; }
+void set_var_degrees_jerk(int32_t value) { degrees_jerk = value; }
+
 int32_t get_var_degrees_per_sec() { return degrees_per_sec; }
 void set_var_degrees_per_sec(int32_t value) { degrees_per_sec = value; }
 
-int32_t get_var_division_steps() { return division_steps; }
+// the moves of a loaded program are shown as the divisions
+int32_t get_var_division_steps() { return division_count(); }
 void set_var_division_steps(int32_t value) { division_steps = value; }
 
+int32_t get_var_division_dwell() { return division_dwell; }
+void set_var_division_dwell(int32_t value) { division_dwell = value; }
+
+int32_t get_var_feed_override() { return feed_override; }
+void set_var_feed_override(int32_t value) { feed_override = value; }
+
 int32_t get_var_entry_type() { return entry_type; }
 void set_var_entry_type(int32_t value) { entry_type = value; }
 
+int32_t get_var_gear_counts() { return gear_counts; }
+void set_var_gear_counts(int32_t value) { gear_counts = value; }
+
 int32_t get_var_jog_command() { return jog_command; }
 void set_var_jog_command(int32_t value) { jog_command = value; }
 
 int32_t get_var_micro_steps() { return micro_steps; }
 void set_var_micro_steps(int32_t value) { micro_steps = value; }
 
+int32_t get_var_mill_turns() { return mill_turns; }
+void set_var_mill_turns(int32_t value) { mill_turns = value; }
+
+int32_t get_var_pitch_error() { return pitch_map[pitch_point]; }
+void set_var_pitch_error(int32_t value) {}
+
+int32_t get_var_pitch_point() { return pitch_point; }
+void set_var_pitch_point(int32_t value) { pitch_point = value; }
+
+int32_t get_var_program_slot() { return program_slot; }
+void set_var_program_slot(int32_t value) {}
+
+int32_t get_var_selected_axis() { return selected_axis; }
+void set_var_selected_axis(int32_t value) {}
+
 int32_t get_var_steps_per_rev() { return steps_per_rev; }
 void set_var_steps_per_rev(int32_t value) { steps_per_rev = value; }
 
-float get_var_absolute_position() { return absolute_position; }
-void set_var_absolute_position(float value) { absolute_position = value; }
+float get_var_absolute_position() {
+    return angle_to_degrees(absolute_position);
+}
+void set_var_absolute_position(float value) {
+    absolute_position = degrees_to_angle(value);
+}
 
-float get_var_current_position() { return current_position; }
-void set_var_current_position(float value) { current_position = value; }
+float get_var_current_position() { return angle_to_degrees(current_position); }
+void set_var_current_position(float value) {
+    current_position = degrees_to_angle(value);
+}
 
 float get_var_degrees_per_rev() { return degrees_per_rev; }
 void set_var_degrees_per_rev(float value) { degrees_per_rev = value; }
 
-float get_var_division_angle() { return division_angle; }
-void set_var_division_angle(float value) { division_angle = value; }
+float get_var_mill_end() { return angle_to_degrees(mill_end); }
+void set_var_mill_end(float value) { mill_end = degrees_to_angle(value); }
+
+float get_var_home_offset() { return angle_to_degrees(home_offset); }
+void set_var_home_offset(float value) {
+    home_offset = degrees_to_angle(value);
+}
+
+int32_t get_var_feedback_counts() { return feedback_counts; }
+void set_var_feedback_counts(int32_t value) { feedback_counts = value; }
+
+// a latched MOTION_ALARM, or ALARM_LOST once there is none while an axis
+// is lost, after an emergency stop or restored from before a move
+int32_t get_var_motion_alarm() {
+    motion_status_t status;
+    motion_get_status(&status);
+    if (status.alarm == MOTION_ALARM_NONE && status.lost) {
+        return ALARM_LOST;
+    }
+    return status.alarm;
+}
+void set_var_motion_alarm(int32_t value) {}
+
+float get_var_division_angle() { return angle_to_degrees(division_angle); }
+void set_var_division_angle(float value) {
+    division_angle = degrees_to_angle(value);
+}
+
+// estimated seconds for the relative move and for a division cycle
+float get_var_move_time() { return motion_time(angle_to_steps(relative_move)); }
+void set_var_move_time(float value) {}
+
+float get_var_cycle_time() { return division_cycle_time(); }
+void set_var_cycle_time(float value) {}
 
-float get_var_division_end() { return division_end; }
-void set_var_division_end(float value) { division_end = value; }
+// the sign of the end angle shows the division direction
+float get_var_division_end() {
+    return angle_to_degrees(division_end) * division_direction;
+}
+void set_var_division_end(float value) {
+    division_direction = value < 0 ? -1 : 1;
+    division_end = degrees_to_angle(value * division_direction);
+}
 
-float get_var_division_start() { return division_start; }
-void set_var_division_start(float value) { division_start = value; }
+float get_var_division_start() { return angle_to_degrees(division_start); }
+void set_var_division_start(float value) {
+    division_start = degrees_to_angle(value);
+}
 
 float get_var_jog_1_step() { return jog_1_step; }
 void set_var_jog_1_step(float value) { jog_1_step = value; }
@@ -711,5 +983,7 @@ void set_var_jog_100_steps(float value) { jog_100_steps = value; }
 float get_var_jog_1000_steps() { return jog_1000_steps; }
 void set_var_jog_1000_steps(float value) { jog_1000_steps = value; }
 
-float get_var_relative_move() { return relative_move; }
-void set_var_relative_move(float value) { relative_move = value; }
+float get_var_relative_move() { return angle_to_degrees(relative_move); }
+void set_var_relative_move(float value) {
+    relative_move = degrees_to_angle(value);
+}
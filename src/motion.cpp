@@ -0,0 +1,760 @@
+// Rotary Table motion logic
+
+#include "motion.h"
+#include "pitch.h"
+#include "profile.h"
+#include "program.h"
+#include "tune.h"
+#include <math.h>
+#include <string.h>
+
+// motion variables
+int32_t approach_direction;          // end moves this way, 0 for either
+int32_t backlash_steps;              // steps of backlash in the drive
+int32_t current_division;            // current division
+int32_t degrees_accel;               // acceleration in degrees per sec ^2
+int32_t degrees_jerk;                // jerk in degrees per sec ^3, 0 off
+int32_t degrees_per_sec;             // velocity in degrees per second
+int32_t division_direction = 1;      // direction of divisions
+int32_t division_dwell;              // dwell at each division in mS
+int32_t division_steps = 1;          // number of divisions
+int32_t feed_override = 100;         // milling speed percent
+int32_t feedback_counts;             // encoder counts per table turn
+int32_t gear_counts;                 // encoder counts per axis turn
+int32_t jog_command;                 // continouous jog command
+int32_t micro_steps;                 // driver microstep setting
+int32_t mill_turns;                  // whole turns before the mill end
+int32_t required_steps;              // required steps for the move
+int32_t selected_axis;               // axis the screens move
+int32_t steps_per_rev;               // motor steps per motor revolution
+uint32_t circle_steps;               // steps in 360 degrees
+angle_t absolute_position;           // position for absolute move
+angle_t current_position;            // current angular position
+angle_t home_offset;                 // angle of the home switch edge
+angle_t division_start;              // start angle for division
+angle_t division_end;                // end angle for division
+angle_t mill_end;                    // angle a milling run ends at
+int64_t division_angle = ANGLE_TURN; // angle of all divisions, signed
+int64_t relative_move;               // user defined relative move
+float angle_per_step = 0;            // angle moved each step
+float degrees_per_rev;               // table degrees per motor revolution
+float jog_1_step;                    // jog distance for 1 step
+float jog_10_steps;                  // jog distance for 10 steps
+float jog_100_steps;                 // jog distance for 100 steps
+float jog_1000_steps;                // jog distance for 1000 steps
+
+// drive settings of every axis
+axis_config_t axis_config[MOTION_AXES];
+
+// division planner
+int32_t division_table[MAX_DIVISIONS + 1]; // steps from start to division
+static int32_t planned_steps;               // divisions of the table
+static int64_t planned_angle;               // division angle of the table
+static uint32_t planned_circle_steps;       // steps in 360 of the table
+static angle_t division_origin;             // where the division start is
+static angle_t motor_position;              // position without pitch error
+static uint32_t planned_pitch;              // pitch map version of the table
+static int32_t planned_axis;                // axis of the table
+static uint32_t planned_program;            // program version of the table
+static int32_t table_divisions;             // moves in the table
+static int32_t table_direction;             // sign of the moves in the table
+static uint32_t plan_count;                 // bumped by each plan
+
+// drive setting changes of each axis, the position before a change is
+// kept as a step of its own circle while the axis stays where the change
+// left it, so a run of changes rounds once from it and changing back
+// comes back to the same step
+struct drive_origin_t {
+    int32_t steps;     // position before the change
+    uint32_t circle;   // steps in 360 then, 0 for none
+    int32_t position;  // position the change left the axis at
+    uint32_t rescaled; // steps in 360 after it
+};
+static drive_origin_t drive_origin[MOTION_AXES];
+
+// milling
+static int32_t mill_direction; // direction of the last milling run
+
+// division cycle program
+static bool program_running;  // the ui is feeding a division cycle
+static int32_t program_next;  // next division to queue
+static int32_t program_first; // division the cycle started from
+static int32_t program_size;  // program steps for each division
+static uint32_t program_base; // completed program steps at the start
+
+static void feed_division_program(const motion_status_t &status);
+
+// make an axis the one the screens move, its drive settings are copied
+// out to be edited and the division cycle starts again
+void motion_select_axis(int32_t axis) {
+    selected_axis = axis;
+    steps_per_rev = axis_config[axis].steps_per_rev;
+    micro_steps = axis_config[axis].micro_steps;
+    degrees_per_rev = axis_config[axis].degrees_per_rev;
+    current_division = 0;
+    set_angle_per_step();
+    set_current_position();
+}
+
+// recalculate the step angles after a change to the drive settings, the
+// selected axis settings are copied back first
+void set_angle_per_step() {
+    axis_config_t &selected = axis_config[selected_axis];
+    selected.steps_per_rev = steps_per_rev;
+    selected.micro_steps = micro_steps;
+    selected.degrees_per_rev = degrees_per_rev;
+    for (axis_config_t &config : axis_config) {
+        config.angle_per_step =
+            config.degrees_per_rev / config.steps_per_rev / config.micro_steps;
+        // from the settings, the float step angle can be a step out
+        config.circle_steps = llround(360.0 * config.steps_per_rev *
+                                      config.micro_steps /
+                                      config.degrees_per_rev);
+    }
+    angle_per_step = selected.angle_per_step;
+    circle_steps = selected.circle_steps;
+    set_jog_angles();
+}
+
+// the drive settings of the selected axis have been edited, the axis is
+// kept at the same angle in the new steps and the rates at the same
+// degrees, so a change of microstepping doesn't lose the zero, and one
+// changed back returns to the step it was on
+void set_drive() {
+    motion_status_t status;
+    motion_get_status(&status);
+    drive_origin_t &origin = drive_origin[selected_axis];
+    int32_t steps = status.position[selected_axis];
+    if (!origin.circle || steps != origin.position ||
+        circle_steps != origin.rescaled) {
+        origin.steps = steps; // moved since, start from here
+        origin.circle = circle_steps;
+    }
+    set_angle_per_step();
+    origin.position = rescale_steps(origin.steps, origin.circle, circle_steps);
+    origin.rescaled = circle_steps;
+    motion_post(MOTION_SET_POSITION, origin.position, selected_axis);
+    set_step_rate();
+    set_acceleration();
+    set_jerk();
+    set_feedback();
+}
+
+// smallest jog available is one step
+// so keep it simple and use some step multiples
+void set_jog_angles() {
+    jog_1_step = angle_per_step * 1;
+    jog_10_steps = angle_per_step * 10;
+    jog_100_steps = angle_per_step * 100;
+    jog_1000_steps = angle_per_step * 1000;
+}
+
+// convert a rate in degrees to steps of an axis, kept in an int32_t
+int32_t step_rate(int32_t axis, int32_t degrees) {
+    float steps_per_degree = 1 / axis_config[axis].angle_per_step;
+    float steps = degrees * steps_per_degree;
+    if (steps > 2e9f) {
+        steps = 2e9f;
+    }
+    return steps;
+}
+
+// the rates are the same in degrees for every axis
+void set_step_rate() {
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        motion_post(MOTION_SET_SPEED, step_rate(axis, degrees_per_sec), axis);
+    }
+}
+
+void set_acceleration() {
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        motion_post(MOTION_SET_ACCELERATION, step_rate(axis, degrees_accel),
+                    axis);
+    }
+}
+
+// a jerk of 0 uses the plain FastAccelStepper ramp
+void set_jerk() {
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        motion_post(MOTION_SET_JERK, step_rate(axis, degrees_jerk), axis);
+    }
+}
+
+// the motion task takes up the backlash and makes the approach moves
+void set_backlash() {
+    motion_post(MOTION_SET_BACKLASH, backlash_steps);
+    motion_post(MOTION_SET_APPROACH, approach_direction);
+}
+
+// the milling speed of a run in progress changes straight away
+void set_feed_override() {
+    motion_post(MOTION_SET_OVERRIDE, feed_override, selected_axis);
+}
+
+// the encoder on the table motor checks for lost steps, feedback_counts
+// counts for a turn of the table, backwards if it is negative, 0 for none
+void set_feedback() {
+    axis_config_t &table = axis_config[0];
+    motion_post(MOTION_FEEDBACK_STEPS, table.circle_steps);
+    motion_post(MOTION_FEEDBACK_LIMIT, FEEDBACK_CORRECT * table.micro_steps);
+    motion_post(MOTION_FEEDBACK, feedback_counts);
+}
+
+// time in seconds for a move of the selected axis
+float motion_time(int32_t steps) {
+    return profile_time(steps, step_rate(selected_axis, degrees_per_sec),
+                        step_rate(selected_axis, degrees_accel),
+                        step_rate(selected_axis, degrees_jerk));
+}
+
+// convert degrees to an angle, the result wraps to a position when it is
+// stored in an angle_t
+int64_t degrees_to_angle(float degrees) {
+    double angle = degrees * (ANGLE_TURN / 360.0);
+    if (angle < 0) {
+        return angle - 0.5;
+    } else {
+        return angle + 0.5;
+    }
+}
+
+// convert an angle to degrees for display
+float angle_to_degrees(int64_t angle) {
+    return angle * (360.0f / ANGLE_TURN);
+}
+
+// convert a step position of an axis to an angle, 0~360
+angle_t axis_steps_to_angle(int32_t axis, int32_t steps) {
+    uint32_t circle = axis_config[axis].circle_steps;
+    int64_t circle_position = steps % (int64_t)circle;
+    if (circle_position < 0) {
+        circle_position += circle;
+    }
+    return ((circle_position << 32) + circle / 2) / circle;
+}
+
+// convert an angle to steps of an axis
+// different rounding dependent on direction
+int32_t axis_angle_to_steps(int32_t axis, int64_t angle) {
+    uint32_t circle = axis_config[axis].circle_steps;
+    if (angle < 0) {
+        return -((-angle * circle + ANGLE_TURN / 2) >> 32);
+    } else {
+        return (angle * circle + ANGLE_TURN / 2) >> 32;
+    }
+}
+
+// convert a position in steps of a circle of from steps to one of to
+// steps, the whole turns are exact and the rest of the turn is rounded to
+// the nearest step, the turns are dropped if they don't fit an int32_t
+int32_t rescale_steps(int32_t steps, uint32_t from, uint32_t to) {
+    int64_t turns = steps / (int64_t)from;
+    int64_t rest = steps % (int64_t)from;
+    if (rest < 0) {
+        rest += from;
+        turns--;
+    }
+    int64_t part = ((uint64_t)rest * to + from / 2) / from;
+    int64_t position = turns * to + part;
+    if (position > INT32_MAX || position < INT32_MIN) {
+        position = part;
+    }
+    return position;
+}
+
+// the same for the selected axis
+angle_t steps_to_angle(int32_t steps) {
+    return axis_steps_to_angle(selected_axis, steps);
+}
+
+int32_t angle_to_steps(int64_t angle) {
+    return axis_angle_to_steps(selected_axis, angle);
+}
+
+// the pitch map is only for the table, the other axes are uncorrected
+static int32_t axis_pitch_offset(angle_t table) {
+    return selected_axis == 0 ? pitch_offset(table) : 0;
+}
+
+static angle_t axis_pitch_to_table(angle_t motor) {
+    return selected_axis == 0 ? pitch_to_table(motor) : motor;
+}
+
+// steps to move the table by an angle from a table position, with the
+// pitch error at both ends taken out
+static int32_t table_steps(angle_t from, int64_t angle) {
+    angle_t to = from + angle;
+    return angle_to_steps(angle + axis_pitch_offset(to) -
+                          axis_pitch_offset(from));
+}
+
+// round a position in 1/2^32 steps to the nearest step
+static int32_t round_steps(int64_t position) {
+    if (position < 0) {
+        return -((-position + ANGLE_TURN / 2 - 1) >> 32);
+    } else {
+        return (position + ANGLE_TURN / 2) >> 32;
+    }
+}
+
+// runs every gui update so it is all integer math
+void set_current_position() {
+    motion_status_t status;
+    motion_get_status(&status);
+    motor_position = steps_to_angle(status.position[selected_axis]);
+    current_position = axis_pitch_to_table(motor_position);
+    if (program_running) {
+        feed_division_program(status);
+    }
+}
+
+void motion_goto_zero(int32_t dir) {
+    int64_t angle;
+    // positive direction
+    if (dir == 1) {
+        angle = ANGLE_TURN - current_position;
+        // negative direction
+    } else {
+        angle = -(int64_t)current_position;
+    }
+    required_steps = table_steps(current_position, angle);
+    // do the move
+    motion_post(MOTION_MOVE, required_steps, selected_axis);
+}
+
+// this function handles:
+//    absolute move (1)
+//    goto division start (2)
+void motion_absolute_move(int32_t dir) {
+    angle_t target;
+    // absolute move
+    if (dir == 1 || dir == -1) {
+        target = absolute_position;
+        // goto division start
+    } else if (dir == 2 || dir == -2) {
+        target = program_slot ? loaded_program.angles[0] : division_start;
+        current_division = 0;
+        // invalid direction
+    } else {
+        return;
+    }
+    // the distance wraps to 0~360 in the direction of the move
+    if (dir > 0) {
+        required_steps = table_steps(current_position,
+                                     (angle_t)(target - current_position));
+    } else {
+        required_steps = table_steps(
+            current_position, -(int64_t)(angle_t)(current_position - target));
+    }
+    // already there, so go once around
+    if (required_steps == 0) {
+        required_steps = circle_steps * (dir > 0 ? 1 : -1);
+    }
+    // divisions are measured from the step the division start is at
+    if (dir == 2 || dir == -2) {
+        division_origin = axis_pitch_to_table(motor_position +
+                                              steps_to_angle(required_steps));
+        plan_divisions();
+    }
+    // do the move
+    motion_post(MOTION_MOVE, required_steps, selected_axis);
+}
+
+void motion_relative_move(int32_t dir) {
+    required_steps = table_steps(current_position, relative_move * dir);
+    motion_post(MOTION_MOVE, required_steps, selected_axis);
+}
+
+// work out the angle covered by the divisions from the start and end
+// angles, the same start and end angle is a full circle
+void set_division_angle() {
+    angle_t angle;
+    if (division_direction == 1) {
+        angle = division_end - division_start;
+    } else {
+        angle = division_start - division_end;
+    }
+    if (angle == 0) {
+        division_angle = ANGLE_TURN * division_direction;
+    } else {
+        division_angle = (int64_t)angle * division_direction;
+    }
+}
+
+// work out the step position of every division from the division start
+// the span is kept in 1/2^32 step units and spread over the divisions
+// Bresenham style, so each division is within half a step of its exact
+// position and the steps never drift however many divisions there are,
+// the pitch error at each division from the division origin is added to
+// the exact position
+static void plan_even_divisions() {
+    int64_t angle = division_angle < 0 ? -division_angle : division_angle;
+    int64_t span = angle * circle_steps;
+    int64_t divisor = (int64_t)division_steps << 32;
+    int64_t whole = span / divisor;     // whole steps in each division
+    int64_t remainder = span % divisor; // leftover to spread
+    int64_t error = divisor / 2;        // round to the nearest step
+    int32_t steps = 0;
+    int32_t dir = division_angle < 0 ? -1 : 1;
+    int32_t start_offset = axis_pitch_offset(division_origin);
+    division_table[0] = 0;
+    for (int32_t i = 1; i <= division_steps; i++) {
+        steps += whole;
+        error += remainder;
+        if (error >= divisor) {
+            steps++;
+            error -= divisor;
+        }
+        division_table[i] = steps;
+        angle_t angle = division_origin + division_angle * i / division_steps;
+        int32_t offset = axis_pitch_offset(angle) - start_offset;
+        if (offset) {
+            // the exact position less the rounded one is in 1/2^32 steps
+            int64_t fraction = (error - divisor / 2) / division_steps;
+            division_table[i] +=
+                round_steps(fraction + (int64_t)offset * dir * circle_steps);
+        }
+    }
+    table_divisions = division_steps;
+    table_direction = division_direction;
+}
+
+// work out the step position of every angle of the loaded program from
+// the first, each one is its exact angle from the division origin with
+// the pitch error added, rounded to the nearest step, so the steps never
+// drift, the table holds signed steps as the moves can go either way
+static void plan_program() {
+    const program_t &program = loaded_program;
+    int64_t angle = 0; // from the first angle, unwrapped
+    int32_t start_offset = axis_pitch_offset(division_origin);
+    division_table[0] = 0;
+    for (int32_t i = 1; i < program.count; i++) {
+        angle += program_move(program.angles[i - 1], program.angles[i],
+                              program.direction);
+        int32_t offset =
+            axis_pitch_offset(division_origin + angle) - start_offset;
+        division_table[i] = round_steps((angle + offset) * circle_steps);
+    }
+    table_divisions = program.count - 1;
+    table_direction = 1;
+}
+
+// plan the loaded program, or evenly spaced divisions if there is none
+void plan_divisions() {
+    if (program_slot) {
+        plan_program();
+    } else {
+        plan_even_divisions();
+    }
+    planned_steps = division_steps;
+    planned_angle = division_angle;
+    planned_circle_steps = circle_steps;
+    planned_pitch = pitch_version();
+    planned_axis = selected_axis;
+    planned_program = program_version();
+    plan_count++;
+}
+
+// replan if the divisions have been edited since the division start
+static void check_divisions() {
+    if (planned_steps != division_steps || planned_angle != division_angle ||
+        planned_circle_steps != circle_steps ||
+        planned_pitch != pitch_version() || planned_axis != selected_axis ||
+        planned_program != program_version()) {
+        plan_divisions();
+        if (current_division > table_divisions) {
+            current_division = table_divisions;
+        }
+    }
+}
+
+// divisions in the cycle, the moves of a loaded program
+int32_t division_count() {
+    check_divisions();
+    return table_divisions;
+}
+
+// move to the next (1) or previous (-1) division, while a division move
+// is in progress the move is queued behind it
+// returns false if there is no division to move to or it can't be queued
+bool motion_goto_division(int32_t division_type) {
+    uint8_t input = motion_input(INPUT_DIVISION);
+    if (input == INPUT_REJECTED) {
+        return false;
+    }
+    check_divisions();
+    int32_t dir;
+    // determine the direction
+    if (division_type == 1 && current_division != table_divisions) {
+        current_division++;
+        dir = table_direction;
+        required_steps = division_table[current_division] -
+                         division_table[current_division - 1];
+    } else if (division_type == -1 && current_division != 0) {
+        current_division--;
+        dir = table_direction * -1;
+        required_steps = division_table[current_division + 1] -
+                         division_table[current_division];
+    } else {
+        return false;
+    }
+    // do the move
+    required_steps *= dir;
+    if (input == INPUT_QUEUED) {
+        motion_program_post(MOTION_MOVE, required_steps, selected_axis);
+    } else {
+        motion_post(MOTION_MOVE, required_steps, selected_axis);
+    }
+    return true;
+}
+
+// run the rest of the division cycle as a motion program, each division
+// is a move then the trigger pulse and dwell if they are wanted
+// returns false if there are no divisions left
+bool motion_run_divisions() {
+    check_divisions();
+    if (program_running || current_division == table_divisions) {
+        return false;
+    }
+    program_size = 1;
+#if TRIGGER_PIN >= 0
+    program_size += 3;
+#endif
+    if (division_dwell > 0) {
+        program_size += 1;
+    }
+    motion_status_t status;
+    motion_get_status(&status);
+    program_base = status.steps;
+    program_first = current_division;
+    program_next = current_division + 1;
+    program_running = true;
+    feed_division_program(status);
+    return true;
+}
+
+// time in seconds for the moves of a program, a move time for every move
+// is too much for every gui update so it is kept until the plan or the
+// rates change
+static float program_moves_time() {
+    static float time;
+    static uint32_t timed_plan;     // plan_count of the time
+    static int32_t timed_rates[3];  // speed, acceleration and jerk
+    static bool timed;              // the time is set
+    int32_t rates[3] = {degrees_per_sec, degrees_accel, degrees_jerk};
+    if (!timed || timed_plan != plan_count ||
+        memcmp(rates, timed_rates, sizeof(rates)) != 0) {
+        time = 0;
+        for (int32_t i = 1; i <= table_divisions; i++) {
+            int32_t steps = division_table[i] - division_table[i - 1];
+            time += motion_time(steps < 0 ? -steps : steps);
+        }
+        timed_plan = plan_count;
+        memcpy(timed_rates, rates, sizeof(rates));
+        timed = true;
+    }
+    return time;
+}
+
+// time in seconds for a division cycle program from the division start,
+// every division is the same number of whole steps or one step more so
+// it only needs two move times
+float division_cycle_time() {
+    check_divisions();
+    float time;
+    if (program_slot) {
+        time = program_moves_time();
+    } else {
+        int32_t total = division_table[table_divisions];
+        int32_t whole = total / table_divisions;
+        int32_t longer = total - whole * table_divisions;
+        time = (table_divisions - longer) * motion_time(whole) +
+               longer * motion_time(whole + 1);
+    }
+    int32_t stop = division_dwell;
+#if TRIGGER_PIN >= 0
+    stop += TRIGGER_PULSE;
+#endif
+    return time + table_divisions * stop / 1000.0f;
+}
+
+// a division cycle program is running
+bool motion_program_running() { return program_running; }
+
+// queue as many divisions as there is room for and follow the progress of
+// the motion task, a division counts once its move is done
+static void feed_division_program(const motion_status_t &status) {
+    while (program_next <= table_divisions &&
+           motion_program_space() >= (uint32_t)program_size) {
+        motion_program_post(MOTION_MOVE,
+                            (division_table[program_next] -
+                             division_table[program_next - 1]) *
+                                table_direction,
+                            selected_axis);
+#if TRIGGER_PIN >= 0
+        motion_program_post(MOTION_OUTPUT, TRIGGER_PIN << 1 | 1);
+        motion_program_post(MOTION_DWELL, TRIGGER_PULSE);
+        motion_program_post(MOTION_OUTPUT, TRIGGER_PIN << 1);
+#endif
+        if (division_dwell > 0) {
+            motion_program_post(MOTION_DWELL, division_dwell);
+        }
+        program_next++;
+    }
+    int32_t done = status.steps - program_base;
+    current_division = program_first + (done + program_size - 1) / program_size;
+    if (current_division > table_divisions) {
+        current_division = table_divisions;
+    }
+    if (done >= (table_divisions - program_first) * program_size) {
+        program_running = false;
+    }
+}
+
+void motion_jog_continuous(int32_t command) {
+    // stop the jog or program
+    if (command == 0) {
+        program_running = false;
+        motion_post(MOTION_STOP);
+        tune_stop();
+        // jog in positive direction
+    } else if (command == 1) {
+        motion_post(MOTION_RUN_FORWARD, 0, selected_axis);
+        // jog in negative direction
+    } else if (command == -1) {
+        motion_post(MOTION_RUN_BACKWARD, 0, selected_axis);
+    }
+}
+
+void motion_jog_incremental(float angle) {
+    required_steps = table_steps(current_position, degrees_to_angle(angle));
+    // do the move
+    motion_post(MOTION_MOVE, required_steps, selected_axis);
+}
+
+void motion_set_zero() { motion_post(MOTION_SET_POSITION, 0, selected_axis); }
+
+// steps from a step position on to the mill end in the direction of the
+// run, at least one step
+static int32_t steps_to_mill_end(int32_t steps, int32_t dir) {
+    angle_t from = axis_pitch_to_table(steps_to_angle(steps));
+    int64_t angle;
+    if (dir > 0) {
+        angle = (angle_t)(mill_end - from);
+    } else {
+        angle = -(int64_t)(angle_t)(from - mill_end);
+    }
+    int32_t end = table_steps(from, angle);
+    // already there, so go once around
+    if (end == 0) {
+        end = circle_steps * dir;
+    }
+    return end;
+}
+
+// start a milling run at the feed override, with no turns it runs on
+// until it is stopped or ended, otherwise it makes the whole turns then
+// stops at the mill end on the ramp
+void motion_mill(int32_t dir) {
+    motion_status_t status;
+    motion_get_status(&status);
+    int32_t position = status.position[selected_axis];
+    int64_t target = position + steps_to_mill_end(position, dir) +
+                     (int64_t)mill_turns * circle_steps * dir;
+    if (target > INT32_MAX || target < INT32_MIN) {
+        return;
+    }
+    mill_direction = dir;
+    set_feed_override();
+    if (mill_turns == 0) {
+        motion_post(MOTION_MILL, dir, selected_axis);
+    } else {
+        motion_post(MOTION_MILL_TO, target, selected_axis);
+    }
+}
+
+// end a milling run at the next mill end it can stop at on its ramp, the
+// stopping distance is worked out from its speed now, with a margin for
+// the run moving on before the motion task gets the new target
+// returns false if the axis is not moving
+bool motion_mill_end() {
+    motion_status_t status;
+    motion_get_status(&status);
+    if (!status.running || mill_direction == 0) {
+        return false;
+    }
+    int32_t position = status.position[selected_axis];
+    float speed = status.speed[selected_axis];
+    if (speed < 0) {
+        speed = -speed;
+    }
+    // it can speed up in the margin
+    float accel = step_rate(selected_axis, degrees_accel);
+    speed += accel * MILL_END_MARGIN;
+    int32_t stop = speed * speed / (2 * accel) + speed * MILL_END_MARGIN;
+    position += stop * mill_direction;
+    motion_post(MOTION_MILL_TO,
+                position + steps_to_mill_end(position, mill_direction),
+                selected_axis);
+    return true;
+}
+
+// have the selected axis follow the encoder, a turn for every gear_counts
+// counts, backwards if it is negative, or stop following
+void motion_gear(bool follow) {
+    if (follow && gear_counts != 0) {
+        motion_post(MOTION_GEAR_STEPS, circle_steps, selected_axis);
+        motion_post(MOTION_GEAR, gear_counts, selected_axis);
+    } else {
+        motion_post(MOTION_GEAR, 0, selected_axis);
+    }
+}
+
+// whether a touch action can be taken, everything can while the axes are
+// stopped and not tuning, while they move stopping and changing a run
+// are, a jog can change direction, another division is queued behind
+// division moves while there is room and anything else waits until they
+// stop
+uint8_t motion_input(uint8_t action) {
+    static uint8_t started = INPUT_OTHER; // action that started the moves
+    motion_status_t status;
+    motion_get_status(&status);
+    if (!status.running && !status.program && !program_running &&
+        !tune_active()) {
+        started = action;
+        return INPUT_NOW;
+    }
+    switch (action) {
+    case INPUT_STOP:
+    case INPUT_OVERRIDE:
+    case INPUT_MILL_END:
+    case INPUT_GEAR_STOP:
+        return INPUT_NOW;
+    case INPUT_JOG:
+        return started == INPUT_JOG ? INPUT_NOW : INPUT_REJECTED;
+    case INPUT_DIVISION:
+        if (started == INPUT_DIVISION && !program_running &&
+            motion_program_space() > 0) {
+            return INPUT_QUEUED;
+        }
+        break;
+    }
+    return INPUT_REJECTED;
+}
+
+// home the selected axis, seeking the switch in the dir direction, the
+// edge of the switch is then at the home offset, in a program it homes
+// once the program steps before it are done
+void motion_home(int32_t dir, bool program) {
+    angle_t motor = home_offset + axis_pitch_offset(home_offset);
+    motion_post(MOTION_HOME_BACK_OFF,
+                angle_to_steps(degrees_to_angle(HOME_BACK_OFF)),
+                selected_axis);
+    motion_post(MOTION_HOME_OFFSET, angle_to_steps(motor), selected_axis);
+    int32_t seek = dir * (int32_t)(HOME_SEEK_TURNS * circle_steps);
+    if (program) {
+        motion_program_post(MOTION_HOME, seek, selected_axis);
+    } else {
+        motion_post(MOTION_HOME, seek, selected_axis);
+    }
+}
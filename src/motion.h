@@ -0,0 +1,154 @@
+// Rotary Table motion logic
+//
+// the step math behind the action handlers, kept free of LVGL and Arduino
+// so it builds both for the ESP32 and for the native simulator, moves are
+// posted to the motion task rather than made on the stepper directly
+//
+// the screens work on the selected axis, the drive settings below are a
+// copy of its settings in axis_config, the backlash, approach and pitch
+// map are the table's, axis 0, and the speeds in degrees are shared
+
+#ifndef MOTION_H
+#define MOTION_H
+
+#include "motion_task.h"
+#include <stdint.h>
+
+#define MAX_DIVISIONS 999      // most divisions in a division cycle
+#define MAX_DWELL 60000        // longest dwell at a division in mS
+#define MAX_BACKLASH 1000      // most backlash steps
+#define MIN_OVERRIDE 10        // slowest milling feed override in percent
+#define MAX_OVERRIDE 200       // fastest milling feed override in percent
+#define MAX_MILL_TURNS 99      // most whole turns of a milling run
+#define MAX_GEAR_COUNTS 999999 // most encoder counts per axis turn
+#define MILL_END_MARGIN 0.05f  // seconds a run can move on before it ends
+#define HOME_BACK_OFF 0.5f     // degrees to back off the home switch
+#define HOME_SEEK_TURNS 1.25f  // furthest to seek the home switch
+#define FEEDBACK_CORRECT 16    // most lost full steps corrected, more alarm
+#define TRIGGER_PULSE 10       // trigger output pulse at a division in mS
+#ifndef TRIGGER_PIN
+#define TRIGGER_PIN -1 // output pulsed at each division, -1 for none
+#endif
+
+// touch input, while the axes move only a few safe actions are taken
+// straight away, stepping on to another division is queued behind the
+// division move in progress and anything else is rejected
+enum INPUT_ACTION {
+    INPUT_STOP,      // stop every axis, ends any program
+    INPUT_JOG,       // continuous jog, or a change of its direction
+    INPUT_OVERRIDE,  // change the milling feed override
+    INPUT_MILL_END,  // end a milling run at the next mill end
+    INPUT_GEAR_STOP, // stop following the encoder
+    INPUT_DIVISION,  // move to the next or previous division
+    INPUT_OTHER,     // any other move, setting or program
+};
+enum INPUT_POLICY {
+    INPUT_NOW,      // do it now
+    INPUT_QUEUED,   // queue it behind the moves in progress
+    INPUT_REJECTED, // ignore it
+};
+
+// angles are a fraction of a turn with 2^32 = 360 degrees, positions are
+// held in an angle_t so wrapping past 360 degrees is free integer overflow
+// and angle spans that can be a full turn or more are held in an int64_t
+typedef uint32_t angle_t;
+#define ANGLE_TURN ((int64_t)1 << 32)
+
+// drive settings of an axis
+struct axis_config_t {
+    int32_t steps_per_rev; // motor steps per motor revolution
+    int32_t micro_steps;   // driver microstep setting
+    float degrees_per_rev; // axis degrees per motor revolution
+    float angle_per_step;  // angle moved each step
+    uint32_t circle_steps; // steps in 360 degrees
+};
+
+// motion variables
+extern int32_t approach_direction;     // end moves this way, 0 for either
+extern int32_t backlash_steps;         // steps of backlash in the drive
+extern int32_t current_division;       // current division
+extern int32_t degrees_accel;          // acceleration in degrees per sec ^2
+extern int32_t degrees_jerk;           // jerk in degrees per sec ^3, 0 off
+extern int32_t degrees_per_sec;        // velocity in degrees per second
+extern int32_t division_direction;     // direction of divisions
+extern int32_t division_dwell;         // dwell at each division in mS
+extern int32_t division_steps;         // number of divisions
+extern int32_t feed_override;          // milling speed percent
+extern int32_t feedback_counts;        // encoder counts per table turn
+extern int32_t gear_counts;            // encoder counts per axis turn
+extern int32_t jog_command;            // continouous jog command
+extern int32_t micro_steps;            // driver microstep setting
+extern int32_t mill_turns;             // whole turns before the mill end
+extern int32_t required_steps;         // required steps for the move
+extern int32_t selected_axis;          // axis the screens move
+extern int32_t steps_per_rev;          // motor steps per motor revolution
+extern uint32_t circle_steps;          // steps in 360 degrees
+extern angle_t absolute_position;      // position for absolute move
+extern angle_t current_position;       // current angular position
+extern angle_t home_offset;            // angle of the home switch edge
+extern angle_t division_start;         // start angle for division
+extern angle_t division_end;           // end angle for division
+extern angle_t mill_end;               // angle a milling run ends at
+extern int64_t division_angle;         // angle of all divisions, signed
+extern int64_t relative_move;          // user defined relative move
+extern float angle_per_step;           // angle moved each step
+extern float degrees_per_rev;          // table degrees per motor revolution
+extern float jog_1_step;               // jog distance for 1 step
+extern float jog_10_steps;             // jog distance for 10 steps
+extern float jog_100_steps;            // jog distance for 100 steps
+extern float jog_1000_steps;           // jog distance for 1000 steps
+
+// drive settings of every axis
+extern axis_config_t axis_config[MOTION_AXES];
+
+// steps from the division start to each division, or to each angle of
+// the loaded program
+extern int32_t division_table[MAX_DIVISIONS + 1];
+
+// settings
+void motion_select_axis(int32_t axis);
+void set_angle_per_step();
+void set_drive();
+void set_jog_angles();
+void set_step_rate();
+void set_acceleration();
+void set_jerk();
+void set_backlash();
+void set_feed_override();
+void set_feedback();
+int32_t step_rate(int32_t axis, int32_t degrees);
+float motion_time(int32_t steps);
+
+// angles
+int64_t degrees_to_angle(float degrees);
+float angle_to_degrees(int64_t angle);
+angle_t steps_to_angle(int32_t steps);
+int32_t angle_to_steps(int64_t angle);
+angle_t axis_steps_to_angle(int32_t axis, int32_t steps);
+int32_t axis_angle_to_steps(int32_t axis, int64_t angle);
+int32_t rescale_steps(int32_t steps, uint32_t from, uint32_t to);
+void set_current_position();
+
+// divisions
+void set_division_angle();
+void plan_divisions();
+int32_t division_count();
+
+// moves
+void motion_goto_zero(int32_t dir);
+void motion_absolute_move(int32_t dir);
+void motion_relative_move(int32_t dir);
+bool motion_goto_division(int32_t division_type);
+bool motion_run_divisions();
+float division_cycle_time();
+bool motion_program_running();
+void motion_jog_continuous(int32_t command);
+void motion_jog_incremental(float angle);
+void motion_set_zero();
+void motion_mill(int32_t dir);
+bool motion_mill_end();
+void motion_gear(bool follow);
+void motion_home(int32_t dir, bool program = false);
+uint8_t motion_input(uint8_t action);
+
+#endif
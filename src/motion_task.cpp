@@ -0,0 +1,1001 @@
+// Rotary Table motion task
+
+#include "motion_task.h"
+#include "encoder.h"
+#include "estop.h"
+#include "feedback.h"
+#include "gearing.h"
+#include "home.h"
+#include "profile.h"
+#include "spsc_queue.h"
+#include <stddef.h>
+#if defined(ARDUINO)
+#include <esp_pm.h>
+#include <esp_timer.h>
+#endif
+
+// stepper engine
+stepper_t *steppers[MOTION_AXES];
+
+// commands from the ui
+static SpscQueue<motion_command_t, MOTION_QUEUE_SIZE> commands;
+
+// each axis, the backlash leaves the stepper position ahead of the table
+// by the backlash after a positive move and level with it after a
+// negative move
+struct axis_t {
+    uint32_t speed;         // steps per second
+    uint32_t accel;         // steps per second^2
+    uint32_t jerk;          // steps per second^3, 0 for none
+    int32_t backlash;       // steps of backlash
+    bool backlash_up;       // the backlash is taken up positive
+    int32_t approach;       // end moves in this direction, 0 for either
+    int32_t approach_steps; // final approach still to make
+    int32_t sync_steps;     // steps in the next synchronised move
+    uint32_t override;      // milling speed percent of speed
+    bool milling;           // a milling run is moving
+};
+static axis_t axes[MOTION_AXES];
+
+// jerk limited moves, one axis at a time
+static uint8_t profile_axis;    // axis the profile is for
+static stepper_command_s entry; // next entry for the stepper queue
+static bool entry_waiting;      // entry is waiting for queue space
+
+// electronic gearing, one axis at a time
+static uint8_t gear_axis;  // axis following the encoder
+static int32_t gear_steps; // steps of the next ratio
+static uint32_t gear_time; // ticks at the last encoder read
+
+// homing, one axis at a time
+enum HOME_STATE {
+    HOME_IDLE,          // not homing
+    HOME_SEEK,          // moving to the switch
+    HOME_SEEK_STOP,     // stopping past it
+    HOME_BACK_OFF,      // moving back off it
+    HOME_APPROACH,      // coming back to it slowly
+    HOME_APPROACH_STOP, // stopping on it
+};
+static uint8_t home_axis;     // axis being homed
+static uint8_t home_state;    // HOME_STATE
+static int32_t home_dir;      // direction of the seek and approach
+static int32_t home_back_off; // steps to back off before the approach
+static int32_t home_position; // position of the switch edge
+static int32_t home_found;    // table position the edge was latched at
+static int32_t home_shift;    // steps the last homing moved the position
+static bool homed;            // the last homing found the switch
+
+// encoder feedback, one axis, it shares the encoder with gearing and
+// measures the motor so it is compared with the stepper position
+static uint8_t feedback_axis;   // axis the encoder measures
+static int32_t feedback_steps;  // steps of the ratio
+static int32_t feedback_counts; // encoder counts of the ratio, 0 for none
+static int32_t feedback_limit;  // most lost steps that are corrected
+static uint32_t feedback_time;  // time in mS of the next check in a move
+static bool feedback_checked;   // checked since the axis stopped
+static int32_t feedback_fixed;  // error the last move corrected, 0 none
+static uint32_t corrections;    // correcting moves made so far
+static uint8_t alarm;           // MOTION_ALARM latched
+static uint8_t lost;            // axes off their position, a bit each
+
+// motion program from the ui
+static SpscQueue<motion_command_t, MOTION_PROGRAM_SIZE> program;
+static motion_command_t program_step; // step in progress
+static bool program_busy;             // waiting for program_step to finish
+static uint32_t program_steps;        // steps completed or dropped
+static uint32_t program_posted;       // steps posted by the ui
+static uint32_t dwell_end;            // time in mS that a dwell ends
+
+// status snapshot, the sequence count is odd while it is being written
+static std::atomic<uint32_t> status_sequence{0};
+static std::atomic<int32_t> status_position[MOTION_AXES];
+static std::atomic<int32_t> status_speed[MOTION_AXES];
+static std::atomic<bool> status_running{false};
+static std::atomic<bool> status_program{false};
+static std::atomic<bool> status_homed{false};
+static std::atomic<int32_t> status_home_shift{0};
+static std::atomic<uint8_t> status_alarm{MOTION_ALARM_NONE};
+static std::atomic<uint8_t> status_lost{0};
+static std::atomic<uint32_t> status_corrections{0};
+static std::atomic<uint32_t> status_steps{0};
+
+#if defined(ARDUINO)
+static TaskHandle_t motion_task_handle = NULL;
+static TaskHandle_t notify_task_handle = NULL; // told when running changes
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t sleep_lock; // no light sleep while stepping
+#endif
+#endif
+
+// commands that start the axes moving, refused while an alarm is latched
+static bool motion_starts(const motion_command_t &command) {
+    switch (command.type) {
+    case MOTION_MOVE:
+    case MOTION_RUN_FORWARD:
+    case MOTION_RUN_BACKWARD:
+    case MOTION_SYNC_MOVE:
+    case MOTION_MILL:
+    case MOTION_MILL_TO:
+    case MOTION_HOME:
+        return true;
+    case MOTION_GEAR:
+        return command.value != 0;
+    }
+    return false;
+}
+
+// called before a command that starts the axes moving is queued
+static void (*start_hook)();
+
+// set a function to call as a move is posted, NULL for none
+void motion_start_hook(void (*hook)()) { start_hook = hook; }
+
+// queue a command for the motion task and wake it up
+// returns false if the queue is full
+bool motion_post(uint8_t type, int32_t value, uint8_t axis) {
+    motion_command_t command = {type, axis, value};
+    if (start_hook && motion_starts(command)) {
+        start_hook();
+    }
+    if (!commands.push(command)) {
+        return false;
+    }
+#if defined(ARDUINO)
+    if (motion_task_handle) {
+        xTaskNotifyGive(motion_task_handle);
+    }
+#endif
+    return true;
+}
+
+// queue a program step for the motion task
+// returns false if the program queue is full
+bool motion_program_post(uint8_t type, int32_t value, uint8_t axis) {
+    motion_command_t command = {type, axis, value};
+    if (start_hook && (motion_starts(command) || type == MOTION_BLEND)) {
+        start_hook();
+    }
+    if (!program.push(command)) {
+        return false;
+    }
+    program_posted++;
+#if defined(ARDUINO)
+    if (motion_task_handle) {
+        xTaskNotifyGive(motion_task_handle);
+    }
+#endif
+    return true;
+}
+
+// room left in the program queue
+uint32_t motion_program_space() { return program.space(); }
+
+// every program step posted has been done or dropped, the status only
+// catches up once the motion task has seen the steps
+bool motion_program_idle(const motion_status_t &status) {
+    return status.steps == program_posted;
+}
+
+// time in mS for dwells
+static uint32_t motion_millis() {
+#if defined(ARDUINO)
+    return millis();
+#else
+    return steppers[0]->now() / (TICKS_PER_S / 1000);
+#endif
+}
+
+// time in ticks for the encoder speed
+static uint32_t motion_ticks() {
+#if defined(ARDUINO)
+    return esp_timer_get_time() * (TICKS_PER_S / 1000000);
+#else
+    return steppers[0]->now();
+#endif
+}
+
+// the jerk limited profile is being fed to a stepper
+static bool profile_busy() { return entry_waiting || profile_active(); }
+
+// the stepper is moving, a jerk limited move has more to queue or it is
+// following the encoder
+static bool stepper_moving(uint8_t axis) {
+    return steppers[axis]->isRunning() ||
+           (axis == profile_axis && profile_busy()) ||
+           (axis == gear_axis && gear_active());
+}
+
+// a move is in progress on any axis, including a final approach still to
+// make or the rest of a homing cycle
+static bool motion_moving() {
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        if (stepper_moving(axis) || axes[axis].approach_steps) {
+            return true;
+        }
+    }
+    return home_state != HOME_IDLE;
+}
+
+// stop an axis on its ramp, or the ramp of a jerk limited move or gearing
+static void stop_axis(uint8_t axis) {
+    if (axis == profile_axis && profile_active()) {
+        profile_stop();
+    } else if (axis == gear_axis && gear_active()) {
+        gear_stop();
+    } else {
+        steppers[axis]->stopMove();
+    }
+}
+
+// steps of backlash that are taken up with the stepper position
+static int32_t taken_up(uint8_t axis) {
+    return axes[axis].backlash_up ? axes[axis].backlash : 0;
+}
+
+// add the steps to take up the backlash when a move changes direction
+static int32_t take_up(uint8_t axis, int32_t steps) {
+    axis_t &a = axes[axis];
+    if (steps > 0 && !a.backlash_up) {
+        a.backlash_up = true;
+        return steps + a.backlash;
+    } else if (steps < 0 && a.backlash_up) {
+        a.backlash_up = false;
+        return steps - a.backlash;
+    }
+    return steps;
+}
+
+// move the stepper position of a stopped axis by steps without moving
+// the motor, the measured position goes with it
+static void shift_position(uint8_t axis, int32_t steps) {
+    stepper_t *stepper = steppers[axis];
+    stepper->setCurrentPosition(stepper->getCurrentPosition() + steps);
+    if (axis == feedback_axis) {
+        feedback_shift(steps);
+    }
+}
+
+// set the table position of a stopped axis
+static void set_position(uint8_t axis, int32_t position) {
+    shift_position(axis, position + taken_up(axis) -
+                             steppers[axis]->getCurrentPosition());
+    lost &= ~(1 << axis);
+}
+
+// top up the stepper queue from the jerk limited profile
+static void profile_service() {
+    stepper_t *stepper = steppers[profile_axis];
+    for (;;) {
+        if (!entry_waiting) {
+            if (!profile_next(&entry)) {
+                return;
+            }
+            entry_waiting = true;
+        }
+        int8_t result = stepper->addQueueEntry(&entry);
+        if (result < 0) {
+            // the stepper would not take it so finish on its own ramp
+            entry_waiting = false;
+            int32_t steps = entry.count_up ? entry.steps : -entry.steps;
+            stepper->move(steps + profile_cancel());
+            return;
+        } else if (result != AQE_OK) {
+            return; // try again when the queue has room
+        }
+        entry_waiting = false;
+    }
+}
+
+// start a move with any backlash take up in the same move, jerk limited
+// if a jerk is set, the stepper is stopped and no other axis has the
+// profile
+static void start_move(uint8_t axis, int32_t steps) {
+    axis_t &a = axes[axis];
+    steps = take_up(axis, steps);
+    if (a.jerk && !stepper_moving(axis) && !profile_busy() &&
+        profile_start(steps, a.speed, a.accel, a.jerk)) {
+        profile_axis = axis;
+        profile_service();
+    } else {
+        steppers[axis]->move(steps);
+    }
+}
+
+// a move against the approach direction goes past the target by the
+// backlash and comes back to it
+static void motion_move(uint8_t axis, int32_t steps) {
+    axis_t &a = axes[axis];
+    if (a.approach && a.backlash && steps &&
+        (steps > 0) != (a.approach > 0)) {
+        a.approach_steps = a.backlash * a.approach;
+        steps -= a.approach_steps;
+    }
+    start_move(axis, steps);
+}
+
+// make the final approach once the move past the target has stopped
+static void approach_service() {
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        int32_t steps = axes[axis].approach_steps;
+        if (steps && !stepper_moving(axis)) {
+            axes[axis].approach_steps = 0;
+            start_move(axis, steps);
+        }
+    }
+}
+
+// a rate for one axis of a synchronised move, at least 1 as the stepper
+// will not take 0
+static uint32_t sync_rate(float rate, float steps) {
+    uint32_t value = rate * steps + 0.5f;
+    return value ? value : 1;
+}
+
+// start the synchronised move, every axis runs the same ramp scaled to
+// its steps, paced by the axis that is slowest for its share of the move,
+// so they start and finish together and the move is a straight line,
+// the backlash is taken up in the move but there is no jerk limit or
+// final approach
+static void sync_move() {
+    float speed = 0; // fraction of the move per second
+    float accel = 0; // fraction of the move per second^2
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        axis_t &a = axes[axis];
+        a.sync_steps = take_up(axis, a.sync_steps);
+        if (a.sync_steps) {
+            float steps = a.sync_steps < 0 ? -a.sync_steps : a.sync_steps;
+            if (speed == 0 || a.speed / steps < speed) {
+                speed = a.speed / steps;
+            }
+            if (accel == 0 || a.accel / steps < accel) {
+                accel = a.accel / steps;
+            }
+        }
+    }
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        axis_t &a = axes[axis];
+        if (a.sync_steps) {
+            float steps = a.sync_steps < 0 ? -a.sync_steps : a.sync_steps;
+            stepper_t *stepper = steppers[axis];
+            stepper->setSpeedInHz(sync_rate(speed, steps));
+            stepper->setAcceleration(sync_rate(accel, steps));
+            stepper->move(a.sync_steps);
+            // only used from the next move on
+            stepper->setSpeedInHz(a.speed);
+            stepper->setAcceleration(a.accel);
+            a.sync_steps = 0;
+        }
+    }
+}
+
+// speed of a milling run, as fast as the stepper can go at most
+static uint32_t mill_speed(uint8_t axis) {
+    axis_t &a = axes[axis];
+    uint64_t speed = (uint64_t)a.speed * a.override / 100;
+    uint32_t max = steppers[axis]->getMaxSpeedInHz();
+    if (speed > max) {
+        return max;
+    }
+    return speed ? speed : 1;
+}
+
+// start a milling run unless the axis is busy with another move
+// returns false if it is busy
+static bool mill_start(uint8_t axis) {
+    axis_t &a = axes[axis];
+    if (!a.milling && stepper_moving(axis)) {
+        return false;
+    }
+    a.milling = true;
+    steppers[axis]->setSpeedInHz(mill_speed(axis));
+    return true;
+}
+
+// go back to the move speed once a milling run stops
+static void mill_service() {
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        axis_t &a = axes[axis];
+        if (a.milling && !steppers[axis]->isRunning()) {
+            a.milling = false;
+            steppers[axis]->setSpeedInHz(a.speed);
+        }
+    }
+}
+
+// start following the encoder from where the axis is, it has to be
+// stopped and no other axis following
+static void gear_follow(uint8_t axis, int32_t counts) {
+    if (stepper_moving(axis) || gear_active()) {
+        return;
+    }
+    feedback_stop(); // until gearing is done with the encoder
+    axis_t &a = axes[axis];
+    uint32_t speed = a.speed;
+    if (speed > steppers[axis]->getMaxSpeedInHz()) {
+        speed = steppers[axis]->getMaxSpeedInHz();
+    }
+    gear_axis = axis;
+    gear_start(gear_steps, counts, speed, a.accel);
+    encoder_read(); // counts before now are not followed
+    gear_time = motion_ticks();
+}
+
+// read the encoder and keep a few slices queued ahead of the stepper, a
+// change of direction takes up the backlash in the slices after it
+static void gear_service() {
+    if (!gear_active()) {
+        return;
+    }
+    stepper_t *stepper = steppers[gear_axis];
+    axis_t &a = axes[gear_axis];
+    uint32_t now = motion_ticks();
+    gear_input(encoder_read(), now - gear_time);
+    gear_time = now;
+    stepper_command_s command;
+    while (!stepper->hasTicksInQueue(GEAR_AHEAD_TICKS) &&
+           gear_next(&command)) {
+        if (command.steps && command.count_up != a.backlash_up) {
+            a.backlash_up = command.count_up;
+            gear_shift(command.count_up ? a.backlash : -a.backlash);
+        }
+        if (stepper->addQueueEntry(&command) != AQE_OK) {
+            gear_stop();
+            return;
+        }
+    }
+}
+
+// final approach speed, slow enough for the latch to be on the step of
+// the edge
+static uint32_t home_speed(uint8_t axis) {
+    uint32_t speed = axes[axis].speed / HOME_SLOW_DIVISOR;
+    if (speed > HOME_SLOW_SPEED) {
+        return HOME_SLOW_SPEED;
+    }
+    return speed ? speed : 1;
+}
+
+// steps a stepper has made in the last age us at its speed now
+static int32_t steps_since(stepper_t *stepper, uint32_t age) {
+    return (int64_t)stepper->getCurrentSpeedInMilliHz() * age / 1000000000;
+}
+
+// start homing an axis, seeking the switch for up to seek steps, nothing
+// else can be moving
+static void home_begin(uint8_t axis, int32_t seek) {
+    if (motion_moving() || seek == 0) {
+        return;
+    }
+    home_axis = axis;
+    home_dir = seek > 0 ? 1 : -1;
+    homed = false;
+    home_arm();
+    start_move(axis, seek);
+    home_state = HOME_SEEK;
+}
+
+// finish homing, found or not
+static void home_end(bool found) {
+    home_disarm();
+    steppers[home_axis]->setSpeedInHz(axes[home_axis].speed);
+    home_state = HOME_IDLE;
+    homed = found;
+}
+
+// step through the homing cycle as each move finishes, the position is
+// set once the axis has stopped after the slow approach so the latched
+// edge is at the home offset, a move that ends without an edge gives up
+static void home_service() {
+    if (home_state == HOME_IDLE) {
+        return;
+    }
+    uint8_t axis = home_axis;
+    stepper_t *stepper = steppers[axis];
+    uint32_t age;
+    bool moving = stepper_moving(axis);
+    int32_t position = stepper->getCurrentPosition() - taken_up(axis);
+    switch (home_state) {
+    case HOME_SEEK:
+        if (home_latched(&age)) {
+            home_found = position - steps_since(stepper, age);
+            stop_axis(axis);
+            home_state = HOME_SEEK_STOP;
+        } else if (!moving) {
+            home_end(false);
+        }
+        break;
+    case HOME_SEEK_STOP:
+        if (!moving) {
+            int32_t back_off = home_found - home_dir * home_back_off;
+            start_move(axis, back_off - position);
+            home_state = HOME_BACK_OFF;
+        }
+        break;
+    case HOME_BACK_OFF:
+        if (!moving) {
+            // the jerk limited profile can't be slowed so it is left out
+            home_arm();
+            stepper->setSpeedInHz(home_speed(axis));
+            stepper->move(take_up(axis, 2 * home_dir * home_back_off));
+            home_state = HOME_APPROACH;
+        }
+        break;
+    case HOME_APPROACH:
+        if (home_latched(&age)) {
+            home_found = position - steps_since(stepper, age);
+            stepper->stopMove();
+            home_state = HOME_APPROACH_STOP;
+        } else if (!moving) {
+            home_end(false);
+        }
+        break;
+    case HOME_APPROACH_STOP:
+        if (!moving) {
+            home_shift = home_position - home_found;
+            set_position(axis, position + home_shift);
+            home_end(true);
+        }
+        break;
+    }
+}
+
+// stop every axis and drop the rest of any program, counting the dropped
+// steps as done
+static void motion_stop() {
+    if (home_state != HOME_IDLE) {
+        home_end(false);
+    }
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        stop_axis(axis);
+        axes[axis].approach_steps = 0;
+        axes[axis].sync_steps = 0;
+    }
+    while (program.pop(program_step)) {
+        program_steps++;
+    }
+    if (program_busy) {
+        program_steps++;
+    }
+    program_busy = false;
+}
+
+// stop everything and latch an alarm
+static void motion_alarm(uint8_t type) {
+    motion_stop();
+    alarm = type;
+}
+
+// start measuring the axis with the encoder from where it is
+static void feedback_begin() {
+    feedback_start(feedback_steps, feedback_counts,
+                   steppers[feedback_axis]->getCurrentPosition());
+    encoder_read(); // counts before now are not measured
+    feedback_checked = true;
+    feedback_fixed = 0;
+}
+
+// the steps were lost so the motor is where the encoder says, set the
+// position of the stopped axis to that
+// returns the steps it was out by
+static int32_t feedback_adopt() {
+    stepper_t *stepper = steppers[feedback_axis];
+    feedback_input(encoder_read());
+    int32_t error = feedback_error(stepper->getCurrentPosition());
+    stepper->setCurrentPosition(stepper->getCurrentPosition() + error);
+    feedback_checked = true;
+    return error;
+}
+
+// compare the measured position with the stepper position, during a move
+// too many lost steps is an alarm, once the axis stops a small error is
+// corrected with a move and anything over the limit, or an error a
+// correction didn't make smaller, is an alarm, what is left within a count
+// after a correction is only the encoder resolution, it starts or starts
+// again once the axis is stopped and the encoder is not in use for gearing
+static void feedback_service() {
+    if (!feedback_active()) {
+        if (feedback_counts && !gear_active() &&
+            !stepper_moving(feedback_axis)) {
+            feedback_begin();
+        }
+        return;
+    }
+    uint8_t axis = feedback_axis;
+    feedback_input(encoder_read());
+    int32_t error = feedback_error(steppers[axis]->getCurrentPosition());
+    int32_t size = error < 0 ? -error : error;
+    if (stepper_moving(axis) || axes[axis].approach_steps) {
+        feedback_checked = false;
+        uint32_t now = motion_millis();
+        if ((int32_t)(now - feedback_time) >= 0) {
+            feedback_time = now + FEEDBACK_CHECK_MS;
+            if (size > feedback_limit) {
+                motion_alarm(MOTION_ALARM_STALL);
+                lost |= 1 << axis;
+            }
+        }
+    } else if (!feedback_checked && alarm == MOTION_ALARM_NONE) {
+        feedback_checked = true;
+        if (size > feedback_limit ||
+            (feedback_fixed && size >= feedback_fixed)) {
+            motion_alarm(MOTION_ALARM_STALL);
+            lost |= 1 << axis;
+            feedback_fixed = 0;
+        } else if (size > feedback_resolution()) {
+            // back to where it should be
+            motion_move(axis, -feedback_adopt());
+            feedback_fixed = size;
+            corrections++;
+        } else {
+            feedback_fixed = 0;
+        }
+    }
+}
+
+// the stop circuit has cut the step outputs, stop the steppers on the
+// steps they were at as the outputs were cut and give them back their
+// outputs, drop whatever was driving them, anything queued since the
+// interrupt included, and latch an alarm, a motor stopped that hard from
+// speed may be off its position, so an axis that has moved since the
+// status was last published is lost and no longer homed
+static void estop_service() {
+    if (!estop_tripped()) {
+        return;
+    }
+    uint8_t moved = 0; // axes moving, a bit each
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        stepper_t *stepper = steppers[axis];
+        if (stepper->isRunning() ||
+            stepper->getCurrentPosition() - taken_up(axis) !=
+                status_position[axis].load(std::memory_order_relaxed)) {
+            moved |= 1 << axis;
+        }
+    }
+    if (profile_active()) {
+        profile_cancel();
+    }
+    if (gear_active()) {
+        gear_cancel();
+    }
+    entry_waiting = false;
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        stepper_t *stepper = steppers[axis];
+        stepper->forceStopAndNewPosition(estop_position(axis));
+    }
+    estop_restore(moved != 0);
+    motion_alarm(MOTION_ALARM_ESTOP);
+    if (moved) {
+        homed = false;
+        lost |= moved;
+    }
+}
+
+// run a command on the stepper
+static void motion_execute(const motion_command_t &command) {
+    uint8_t axis = command.axis;
+    axis_t &a = axes[axis];
+    stepper_t *stepper = steppers[axis];
+    if (alarm != MOTION_ALARM_NONE && motion_starts(command)) {
+        return;
+    }
+    switch (command.type) {
+    case MOTION_MOVE:
+        motion_move(axis, command.value);
+        break;
+    case MOTION_RUN_FORWARD:
+        stepper->runForward();
+        a.backlash_up = true;
+        break;
+    case MOTION_RUN_BACKWARD:
+        stepper->runBackward();
+        a.backlash_up = false;
+        break;
+    case MOTION_STOP:
+        motion_stop();
+        break;
+    case MOTION_SET_POSITION:
+        set_position(axis, command.value);
+        break;
+    case MOTION_SET_SPEED:
+        a.speed = command.value;
+        stepper->setSpeedInHz(a.milling ? mill_speed(axis) : a.speed);
+        break;
+    case MOTION_SET_ACCELERATION:
+        stepper->setAcceleration(command.value);
+        a.accel = command.value;
+        break;
+    case MOTION_SET_JERK:
+        a.jerk = command.value;
+        break;
+    case MOTION_SET_BACKLASH:
+        // keep the table position
+        if (a.backlash_up) {
+            shift_position(axis, command.value - a.backlash);
+        }
+        a.backlash = command.value;
+        break;
+    case MOTION_SET_APPROACH:
+        a.approach = command.value;
+        break;
+    case MOTION_SYNC_STEPS:
+        a.sync_steps = command.value;
+        break;
+    case MOTION_SYNC_MOVE:
+        sync_move();
+        break;
+    case MOTION_MILL:
+        if (mill_start(axis)) {
+            if (command.value > 0) {
+                stepper->runForward();
+            } else {
+                stepper->runBackward();
+            }
+            a.backlash_up = command.value > 0;
+        }
+        break;
+    case MOTION_MILL_TO:
+        // a running stepper turns to the new target on its own ramp
+        if (mill_start(axis)) {
+            take_up(axis, command.value - (stepper->getCurrentPosition() -
+                                           taken_up(axis)));
+            stepper->moveTo(command.value + taken_up(axis));
+        }
+        break;
+    case MOTION_GEAR_STEPS:
+        gear_steps = command.value;
+        break;
+    case MOTION_GEAR:
+        if (command.value) {
+            gear_follow(axis, command.value);
+        } else if (axis == gear_axis) {
+            gear_stop();
+        }
+        break;
+    case MOTION_HOME_BACK_OFF:
+        home_back_off = command.value;
+        break;
+    case MOTION_HOME_OFFSET:
+        home_position = command.value;
+        break;
+    case MOTION_HOME:
+        home_begin(axis, command.value);
+        break;
+    case MOTION_FEEDBACK_STEPS:
+        feedback_steps = command.value;
+        break;
+    case MOTION_FEEDBACK_LIMIT:
+        feedback_limit = command.value;
+        break;
+    case MOTION_FEEDBACK:
+        // starts with the new ratio once the axis is stopped
+        feedback_axis = axis;
+        feedback_counts = command.value;
+        feedback_stop();
+        break;
+    case MOTION_CLEAR_ALARM:
+        // once stopped and the stop button is released, with the position
+        // the encoder measured
+        if (!motion_moving() &&
+            (alarm != MOTION_ALARM_ESTOP || !estop_pressed())) {
+            if (feedback_active()) {
+                feedback_adopt();
+                lost &= ~(1 << feedback_axis);
+            }
+            alarm = MOTION_ALARM_NONE;
+        }
+        break;
+    case MOTION_POSITION_LOST:
+        lost |= 1 << axis;
+        break;
+    case MOTION_SET_OVERRIDE:
+        a.override = command.value;
+        if (a.milling) {
+            stepper->setSpeedInHz(mill_speed(axis));
+            stepper->applySpeedAcceleration();
+        }
+        break;
+    }
+}
+
+// a blend joins the program move in progress when it is on the same axis
+// and goes the same way and the stepper is still going that way, not with
+// a jerk limit as the profile can't change its end part way and the raw
+// queue it feeds can't take a move
+static bool blend_joins(const motion_command_t &blend) {
+    uint8_t axis = blend.axis;
+    axis_t &a = axes[axis];
+    int32_t value = program_step.value;
+    bool against = a.approach && a.backlash && (value > 0) != (a.approach > 0);
+    return blend.type == MOTION_BLEND && blend.value &&
+           (program_step.type == MOTION_MOVE ||
+            program_step.type == MOTION_BLEND) &&
+           program_step.axis == axis && (blend.value > 0) == (value > 0) &&
+           steppers[axis]->isRunning() && (!against || a.approach_steps) &&
+           !a.jerk;
+}
+
+// start program steps until one has to be waited for, a blend that can
+// join the move in progress is added to it so the table doesn't stop
+// between them, any final approach is still made at the end, a move
+// started outside the program is waited for
+static void program_service() {
+    for (;;) {
+        if (program_busy) {
+            if (program_step.type == MOTION_DWELL) {
+                if ((int32_t)(motion_millis() - dwell_end) < 0) {
+                    return;
+                }
+            } else if (motion_moving()) {
+                motion_command_t blend;
+                if (alarm != MOTION_ALARM_NONE || !program.peek(blend) ||
+                    !blend_joins(blend)) {
+                    return;
+                }
+                program.pop(program_step);
+                steppers[blend.axis]->move(take_up(blend.axis, blend.value));
+                program_steps++; // the move it joined
+                continue;
+            }
+            program_busy = false;
+            program_steps++;
+        }
+        if (motion_moving() || !program.pop(program_step)) {
+            return;
+        }
+        if (alarm != MOTION_ALARM_NONE) {
+            program_steps++; // dropped
+            continue;
+        }
+        uint8_t axis = program_step.axis;
+        switch (program_step.type) {
+        case MOTION_MOVE:
+        case MOTION_BLEND:
+            motion_move(axis, program_step.value);
+            program_busy = true;
+            break;
+        case MOTION_SYNC_STEPS:
+            axes[axis].sync_steps = program_step.value;
+            program_steps++;
+            break;
+        case MOTION_SYNC_MOVE:
+            sync_move();
+            program_busy = true;
+            break;
+        case MOTION_DWELL:
+            dwell_end = motion_millis() + program_step.value;
+            program_busy = true;
+            break;
+        case MOTION_OUTPUT:
+#if defined(ARDUINO)
+            digitalWrite(program_step.value >> 1, program_step.value & 1);
+#endif
+            program_steps++;
+            break;
+        case MOTION_SET_POSITION:
+            set_position(axis, program_step.value);
+            program_steps++;
+            break;
+        case MOTION_HOME:
+            home_begin(axis, program_step.value);
+            program_busy = true;
+            break;
+        }
+    }
+}
+
+// run any queued commands and program steps then publish the stepper
+// status
+void motion_service() {
+    motion_command_t command;
+    estop_service();
+    while (commands.pop(command)) {
+        motion_execute(command);
+    }
+    profile_service();
+    approach_service();
+    feedback_service();
+    program_service();
+    mill_service();
+    gear_service();
+    home_service();
+    uint32_t sequence = status_sequence.load(std::memory_order_relaxed);
+    status_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        status_position[axis].store(steppers[axis]->getCurrentPosition() -
+                                        taken_up(axis),
+                                    std::memory_order_relaxed);
+        status_speed[axis].store(
+            steppers[axis]->getCurrentSpeedInMilliHz() / 1000,
+            std::memory_order_relaxed);
+    }
+    status_running.store(motion_moving(), std::memory_order_relaxed);
+    status_program.store(program_busy || !program.empty(),
+                         std::memory_order_relaxed);
+    status_homed.store(homed, std::memory_order_relaxed);
+    status_home_shift.store(home_shift, std::memory_order_relaxed);
+    status_alarm.store(alarm, std::memory_order_relaxed);
+    status_lost.store(lost, std::memory_order_relaxed);
+    status_corrections.store(corrections, std::memory_order_relaxed);
+    status_steps.store(program_steps, std::memory_order_relaxed);
+    status_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+// read a consistent copy of the stepper status
+void motion_get_status(motion_status_t *status) {
+    uint32_t sequence;
+    do {
+        sequence = status_sequence.load(std::memory_order_acquire);
+        for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+            status->position[axis] =
+                status_position[axis].load(std::memory_order_relaxed);
+            status->speed[axis] =
+                status_speed[axis].load(std::memory_order_relaxed);
+        }
+        status->running = status_running.load(std::memory_order_relaxed);
+        status->program = status_program.load(std::memory_order_relaxed);
+        status->homed = status_homed.load(std::memory_order_relaxed);
+        status->home_shift =
+            status_home_shift.load(std::memory_order_relaxed);
+        status->alarm = status_alarm.load(std::memory_order_relaxed);
+        status->lost = status_lost.load(std::memory_order_relaxed);
+        status->corrections =
+            status_corrections.load(std::memory_order_relaxed);
+        status->steps = status_steps.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) ||
+             sequence != status_sequence.load(std::memory_order_relaxed));
+}
+
+#if defined(ARDUINO)
+// sleep until a command arrives, or wake every tick to refresh the
+// status and start the next program step while the stepper is running or
+// a program is in progress
+static void motion_task(void *parameter) {
+    bool was_running = false;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, was_running ? 1 : portMAX_DELAY);
+        motion_service();
+        bool running = motion_moving() || program_busy;
+        if (running != was_running) {
+#if CONFIG_PM_ENABLE
+            if (running) {
+                esp_pm_lock_acquire(sleep_lock);
+            } else {
+                esp_pm_lock_release(sleep_lock);
+            }
+#endif
+            if (notify_task_handle) {
+                xTaskNotifyGive(notify_task_handle);
+            }
+            was_running = running;
+        }
+    }
+}
+
+void motion_task_start() {
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "motion", &sleep_lock);
+#endif
+    xTaskCreatePinnedToCore(motion_task, "motion", 4096, NULL,
+                            MOTION_TASK_PRIORITY, &motion_task_handle,
+                            MOTION_TASK_CORE);
+    // run anything posted before the task started
+    xTaskNotifyGive(motion_task_handle);
+}
+
+// wake the motion task from an interrupt
+void IRAM_ATTR motion_wake_from_isr() {
+    BaseType_t woken = pdFALSE;
+    if (motion_task_handle) {
+        vTaskNotifyGiveFromISR(motion_task_handle, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+
+// a task to wake when the steppers start or stop
+void motion_notify_task(TaskHandle_t task) { notify_task_handle = task; }
+#else
+// the simulator calls motion_service() itself
+void motion_task_start() {}
+#endif
@@ -0,0 +1,156 @@
+// Rotary Table motion task
+//
+// the stepper is only ever touched by the motion task, running on its own
+// core on the ESP32, the ui posts commands to it through a lock free queue
+// and reads back a snapshot of the stepper status, the task sleeps unless
+// there is a command to run or the stepper is moving
+//
+// moves are made with the FastAccelStepper ramp, or with a jerk limited
+// profile fed to its raw command queue when a jerk is set, the backlash is
+// taken up within the move whenever it changes direction and positions are
+// table positions with the backlash taken out
+//
+// every axis has its own stepper and commands say which one they are for,
+// a synchronised move sets the steps for each axis then starts them all
+// together on the same ramp scaled to each axis, so they all start and
+// finish together
+//
+// a milling run turns an axis at its speed scaled by a feed override, it
+// runs on or goes to a target, and the override can be changed while it
+// moves, it is always on the FastAccelStepper ramp as the jerk limited
+// profile can't change speed part way
+//
+// electronic gearing has an axis follow an encoder, one axis at a time,
+// it feeds the stepper raw queue so it can't run with a jerk limited move
+//
+// homing seeks the home switch, backs off and comes back to it slowly,
+// the switch interrupt latches the step position at its edge and the
+// position is then set so the edge is at the home offset
+//
+// encoder feedback measures the motor with the gearing encoder instead,
+// so the two can't be used together, the measured position is checked
+// against the stepper during moves and when the axis stops, a few lost
+// steps are put back with a correcting move and more than that stops every
+// axis and latches an alarm, nothing moves until the alarm is cleared
+//
+// the emergency stop button stops the steppers in its own interrupt, the
+// motion task then drops the moves that were driving them and latches an
+// alarm that can only be cleared once the button is released
+//
+// an axis the emergency stop caught moving, or that lost more steps than
+// feedback corrects, is marked as lost until it is homed or set, or the
+// stall alarm is cleared with the position the encoder measured
+//
+// a hook can be set that is called as a command or program step that
+// starts the axes moving is posted, before the motion task sees it, so
+// the ui can note the move while everything is still stopped
+//
+// a motion program is a second queue of moves, dwells, outputs, homing
+// and position sets that the ui keeps topped up, the motion task starts
+// each step as soon as the one before it is done so a sequence runs
+// without waiting on the ui, a blend is added to the move before it
+// while that is still going the same way so the two run as one
+
+#ifndef MOTION_TASK_H
+#define MOTION_TASK_H
+
+#include <stdint.h>
+
+#if defined(ARDUINO)
+#include "FastAccelStepper.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+typedef FastAccelStepper stepper_t;
+#else
+#include "sim/sim_stepper.h"
+typedef SimStepper stepper_t;
+#endif
+
+#define MOTION_AXES 2          // steppers driven, the table is axis 0
+#define MOTION_QUEUE_SIZE 16   // commands waiting for the motion task
+#define MOTION_PROGRAM_SIZE 32 // program steps queued ahead of the stepper
+#define MOTION_TASK_CORE 1     // motion core, the ui runs on the other one
+#define MOTION_TASK_PRIORITY 5 // above the ui and arduino tasks
+
+// motion commands
+enum MOTION_COMMAND {
+    MOTION_MOVE,             // relative move by value steps
+    MOTION_RUN_FORWARD,      // continuous positive run
+    MOTION_RUN_BACKWARD,     // continuous negative run
+    MOTION_STOP,             // stop every axis, ends any program
+    MOTION_SET_POSITION,     // set the current position to value
+    MOTION_SET_SPEED,        // set the speed to value steps per second
+    MOTION_SET_ACCELERATION, // set the acceleration to value steps/s^2
+    MOTION_SET_JERK,         // set the jerk to value steps/s^3, 0 for none
+    MOTION_SET_BACKLASH,     // set the backlash to value steps
+    MOTION_SET_APPROACH,     // end moves in the value direction, 0 for both
+    MOTION_DWELL,            // program only, wait for value mS
+    MOTION_OUTPUT,           // program only, set output value >> 1 to bit 0
+    MOTION_BLEND,            // program only, move value steps, joining
+                             // the move before it going the same way
+    MOTION_SYNC_STEPS,       // value steps for the next synchronised move
+    MOTION_SYNC_MOVE,        // start the synchronised move of every axis
+    MOTION_MILL,             // milling run in the value direction
+    MOTION_MILL_TO,          // milling run to value, or end a run there
+    MOTION_SET_OVERRIDE,     // set the milling speed to value percent
+    MOTION_GEAR_STEPS,       // value steps for the next gearing ratio
+    MOTION_GEAR,             // follow the encoder, value counts to the
+                             // steps, 0 to stop
+    MOTION_HOME_BACK_OFF,    // value steps to back off the switch
+    MOTION_HOME_OFFSET,      // value position of the home switch edge
+    MOTION_HOME,             // home, seeking up to value steps either way
+    MOTION_FEEDBACK_STEPS,   // value steps for the next feedback ratio
+    MOTION_FEEDBACK_LIMIT,   // correct up to value lost steps, alarm above
+    MOTION_FEEDBACK,         // measure with the encoder, value counts to
+                             // the steps, 0 to stop
+    MOTION_CLEAR_ALARM,      // clear a latched alarm
+    MOTION_POSITION_LOST,    // the position may be off until homed or set
+};
+
+// latched alarms
+enum MOTION_ALARM {
+    MOTION_ALARM_NONE,  // no alarm
+    MOTION_ALARM_STALL, // the encoder says more steps were lost than the
+                        // limit
+    MOTION_ALARM_ESTOP, // the emergency stop button was pressed
+};
+
+struct motion_command_t {
+    uint8_t type;  // MOTION_COMMAND
+    uint8_t axis;  // axis it is for
+    int32_t value; // command argument
+};
+
+// stepper status published by the motion task
+struct motion_status_t {
+    int32_t position[MOTION_AXES]; // current table step position
+    int32_t speed[MOTION_AXES];    // current steps per second, signed
+    bool running;                  // any stepper is moving
+    bool program;                  // a program step is queued or running
+    bool homed;                    // the last homing found the switch
+    int32_t home_shift;            // steps the last homing moved the
+                                   // position by
+    uint8_t alarm;                 // MOTION_ALARM latched
+    uint8_t lost;                  // axes that may be off their position
+                                   // until homed or set, a bit each
+    uint32_t corrections;          // moves the encoder feedback corrected
+    uint32_t steps;                // program steps done or dropped so far
+};
+
+// the stepper of each axis
+extern stepper_t *steppers[MOTION_AXES];
+
+bool motion_post(uint8_t type, int32_t value = 0, uint8_t axis = 0);
+bool motion_program_post(uint8_t type, int32_t value = 0, uint8_t axis = 0);
+void motion_start_hook(void (*hook)());
+uint32_t motion_program_space();
+bool motion_program_idle(const motion_status_t &status);
+void motion_service();
+void motion_get_status(motion_status_t *status);
+void motion_task_start();
+#if defined(ARDUINO)
+void motion_notify_task(TaskHandle_t task);
+void motion_wake_from_isr();
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+// Rotary Table pitch error map
+
+#include "pitch.h"
+
+#define POINT_SHIFT (32 - PITCH_BITS)           // angle bits in a point
+#define POINT_WIDTH ((int64_t)1 << POINT_SHIFT) // angle between points
+
+int16_t pitch_map[PITCH_POINTS]; // error in arc seconds
+
+static int32_t errors[PITCH_POINTS + 1]; // error in angle units, wrapped
+static bool enabled;                      // some error is set
+static uint32_t version;                  // changes with the map
+
+// convert the map to angle units, the extra point at the end is the first
+// one again so the interpolation wraps past 360 degrees
+void pitch_update() {
+    enabled = false;
+    for (int i = 0; i < PITCH_POINTS; i++) {
+        int64_t error = pitch_map[i] * ANGLE_TURN;
+        errors[i] = (error + (error < 0 ? -648000 : 648000)) / 1296000;
+        if (errors[i]) {
+            enabled = true;
+        }
+    }
+    errors[PITCH_POINTS] = errors[0];
+    version++;
+}
+
+// bumped on each update so plans made with the old map can be redone
+uint32_t pitch_version() { return version; }
+
+// divide rounding to the nearest, the divisor is always positive
+static int64_t divide(int64_t value, int64_t divisor) {
+    value += divisor / 2;
+    int64_t result = value / divisor;
+    return value % divisor < 0 ? result - 1 : result;
+}
+
+// interpolated error at a motor angle
+static int32_t error_at(angle_t motor) {
+    uint32_t point = motor >> POINT_SHIFT;
+    int64_t fraction = motor & (POINT_WIDTH - 1);
+    int64_t step = errors[point + 1] - errors[point];
+    return errors[point] + divide(step * fraction, POINT_WIDTH);
+}
+
+// the table angle the motor angle really moves the table to
+angle_t pitch_to_table(angle_t motor) {
+    if (!enabled) {
+        return motor;
+    }
+    return motor + error_at(motor);
+}
+
+// the motor angle to move to for a table angle, less the table angle
+// the error is a straight line between map points so the motor angle is
+// solved exactly within a point, starting from the point of the motor
+// angle less the error and moving over one if the answer is not in it,
+// the map errors are small enough for the table to always move forward
+// as the motor does
+int32_t pitch_offset(angle_t table) {
+    if (!enabled) {
+        return 0;
+    }
+    uint32_t point = (angle_t)(table - error_at(table)) >> POINT_SHIFT;
+    for (int i = 0; i < 4; i++) {
+        angle_t start = (angle_t)point << POINT_SHIFT;
+        int64_t step = errors[point + 1] - errors[point];
+        int32_t offset = table - start - errors[point];
+        int64_t motor = divide(offset * POINT_WIDTH, POINT_WIDTH + step);
+        if (motor < 0) {
+            point = (point - 1) & (PITCH_POINTS - 1);
+        } else if (motor >= POINT_WIDTH) {
+            point = (point + 1) & (PITCH_POINTS - 1);
+        } else {
+            return (int32_t)(angle_t)(start + motor - table);
+        }
+    }
+    return -error_at(table);
+}
@@ -0,0 +1,30 @@
+// Rotary Table pitch error map
+//
+// the measured error of the table at evenly spaced angles around the
+// circle, the error is the table angle an indicator shows minus the angle
+// the table was moved to without any correction, angles between the map
+// points are interpolated, it is all integer math on the 2^32 angles so it
+// costs next to nothing in the move planning
+
+#ifndef PITCH_H
+#define PITCH_H
+
+#include "motion.h"
+#include <stdint.h>
+
+#ifndef PITCH_BITS
+#define PITCH_BITS 8 // 2^PITCH_BITS map points, about one per degree
+#endif
+#define PITCH_POINTS (1 << PITCH_BITS) // points in the map
+#define PITCH_MAX_ERROR 600            // largest error in arc seconds
+
+// error in arc seconds at each map point, point i is at i/PITCH_POINTS of
+// a turn, call pitch_update() after changing it
+extern int16_t pitch_map[PITCH_POINTS];
+
+void pitch_update();
+uint32_t pitch_version();
+angle_t pitch_to_table(angle_t motor);
+int32_t pitch_offset(angle_t table);
+
+#endif
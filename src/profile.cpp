@@ -0,0 +1,320 @@
+// Rotary Table jerk limited profile
+
+#include "profile.h"
+#include <math.h>
+
+enum PROFILE_PHASE { PHASE_DONE, PHASE_ACCEL, PHASE_CRUISE, PHASE_DECEL };
+
+// timing of a ramp to full speed
+struct ramp_t {
+    float speed;      // full speed in steps/s
+    float jerk;       // jerk in steps/s^3
+    float accel;      // acceleration reached in steps/s^2
+    float jerk_time;  // time to reach the peak acceleration
+    float accel_time; // time at the peak acceleration
+    float time;       // time to reach full speed
+};
+
+// ramp to full speed
+static ramp_t plan;
+static profile_entry_t ramp[PROFILE_ENTRIES];
+static int32_t ramp_count; // entries in the ramp table
+
+// move being fed to the stepper queue
+static uint8_t phase = PHASE_DONE;
+static bool count_up;          // direction of the move
+static int32_t ramp_index;     // next ramp table entry
+static int32_t cruise_steps;   // steps left at full speed
+static uint32_t cruise_ticks;  // step interval at full speed
+static uint8_t cruise_chunk;   // steps in each full speed entry
+static uint32_t entry_ticks;   // interval of the entry being split up
+static uint16_t entry_steps;   // steps left in the entry
+static int32_t entry_pauses;   // pauses left before the step, -1 unset
+static int32_t unqueued_steps; // steps not yet in the stepper queue
+
+// speed during the ramp at time t
+static float ramp_speed(float t) {
+    if (t < plan.jerk_time) {
+        return plan.jerk * t * t / 2;
+    }
+    float v1 = plan.accel * plan.jerk_time / 2;
+    if (t < plan.jerk_time + plan.accel_time) {
+        return v1 + plan.accel * (t - plan.jerk_time);
+    }
+    float v2 = v1 + plan.accel * plan.accel_time;
+    t -= plan.jerk_time + plan.accel_time;
+    return v2 + plan.accel * t - plan.jerk * t * t / 2;
+}
+
+// position during the ramp at time t
+static float ramp_position(float t) {
+    if (t < plan.jerk_time) {
+        return plan.jerk * t * t * t / 6;
+    }
+    float v1 = plan.accel * plan.jerk_time / 2;
+    float s1 = v1 * plan.jerk_time / 3;
+    if (t < plan.jerk_time + plan.accel_time) {
+        t -= plan.jerk_time;
+        return s1 + v1 * t + plan.accel * t * t / 2;
+    }
+    float v2 = v1 + plan.accel * plan.accel_time;
+    float s2 = s1 + v1 * plan.accel_time +
+               plan.accel * plan.accel_time * plan.accel_time / 2;
+    t -= plan.jerk_time + plan.accel_time;
+    return s2 + v2 * t + plan.accel * t * t / 2 - plan.jerk * t * t * t / 6;
+}
+
+// time the ramp reaches a position after time t, newton's method kept in
+// a bracket that is halved whenever a step would leave it
+static float ramp_solve(float position, float t) {
+    float low = t;
+    float high = plan.time;
+    float v = ramp_speed(t);
+    if (v > 0) {
+        t += (position - ramp_position(t)) / v;
+    } else {
+        t = cbrtf(6 * position / plan.jerk);
+    }
+    for (int i = 0; i < 30; i++) {
+        if (t <= low || t >= high) {
+            t = (low + high) / 2;
+        }
+        float error = ramp_position(t) - position;
+        if (fabsf(error) < 1e-4f) {
+            break;
+        }
+        if (error < 0) {
+            low = t;
+        } else {
+            high = t;
+        }
+        v = ramp_speed(t);
+        if (v > 0) {
+            t -= error / v;
+        }
+    }
+    return t;
+}
+
+// work out the ramp timing for a peak speed
+static void set_ramp(ramp_t *timing, float speed, float accel) {
+    timing->speed = speed;
+    if (speed * timing->jerk < accel * accel) {
+        // the jerk limit stops the acceleration reaching its limit
+        timing->jerk_time = sqrtf(speed / timing->jerk);
+        timing->accel = timing->jerk * timing->jerk_time;
+        timing->accel_time = 0;
+    } else {
+        timing->jerk_time = accel / timing->jerk;
+        timing->accel = accel;
+        timing->accel_time = speed / accel - timing->jerk_time;
+    }
+    timing->time = 2 * timing->jerk_time + timing->accel_time;
+}
+
+// work out the ramps for a move of distance steps, a move too short to
+// reach full speed gets the highest speed that the ramps up and down fit
+static void plan_ramp(ramp_t *timing, int32_t distance, float speed,
+                      float accel, float jerk) {
+    timing->jerk = jerk;
+    set_ramp(timing, speed, accel);
+    if (speed * timing->time > distance) {
+        float a = accel;
+        float v = a * (sqrtf(a * a / (jerk * jerk) + 4 * distance / a) -
+                       a / jerk) /
+                  2;
+        if (v * jerk < a * a) {
+            v = cbrtf((float)distance * distance * jerk / 4);
+        }
+        set_ramp(timing, v, accel);
+    }
+}
+
+// plan a move of steps at up to speed steps/s and accel steps/s^2 with
+// the acceleration changing at no more than jerk steps/s^3
+// returns false if the ramp does not fit in the table
+bool profile_start(int32_t steps, uint32_t speed, uint32_t accel,
+                   uint32_t jerk) {
+    int32_t distance = steps < 0 ? -steps : steps;
+    if (distance == 0 || speed == 0 || accel == 0 || jerk == 0) {
+        return false;
+    }
+    plan_ramp(&plan, distance, speed, accel, jerk);
+    float v = plan.speed;
+    // whole steps in each ramp, anything left over is at full speed
+    int32_t ramp_steps = v * plan.time / 2 + 0.5f;
+    if (ramp_steps > distance / 2) {
+        ramp_steps = distance / 2;
+    }
+    // longer ramps get longer entries to fit the table
+    float slice = plan.time / (PROFILE_ENTRIES / 2);
+    if (slice < PROFILE_SLICE) {
+        slice = PROFILE_SLICE;
+    }
+    ramp_count = 0;
+    float t = 0;
+    double queued = 0; // ticks in the table so far
+    for (int32_t position = 0; position < ramp_steps;) {
+        if (ramp_count == PROFILE_ENTRIES) {
+            return false;
+        }
+        int32_t count = ramp_speed(t) * slice;
+        if (count < 1) {
+            count = 1;
+        } else if (count > 65535) {
+            count = 65535;
+        }
+        if (count > ramp_steps - position) {
+            count = ramp_steps - position;
+        }
+        position += count;
+        t = ramp_solve(position, t);
+        double ticks = ((double)t * TICKS_PER_S - queued) / count + 0.5;
+        if (ticks < 1) {
+            ticks = 1;
+        }
+        ramp[ramp_count].ticks = ticks;
+        ramp[ramp_count].steps = count;
+        queued += (double)ramp[ramp_count].ticks * count;
+        ramp_count++;
+    }
+    cruise_steps = distance - 2 * ramp_steps;
+    cruise_ticks = TICKS_PER_S / v + 0.5f;
+    if (distance == 1) {
+        // a single step still takes the time of the ramps
+        cruise_ticks = TICKS_PER_S * (plan.time + 1 / v) + 0.5f;
+    }
+    int32_t chunk = v * PROFILE_SLICE;
+    cruise_chunk = chunk < 1                   ? 1
+                   : chunk > PROFILE_MAX_STEPS ? PROFILE_MAX_STEPS
+                                               : chunk;
+    count_up = steps > 0;
+    ramp_index = 0;
+    entry_steps = 0;
+    entry_pauses = -1;
+    unqueued_steps = distance;
+    phase = PHASE_ACCEL;
+    return true;
+}
+
+// load the next run of steps, returns false at the end of the move
+static bool next_entry() {
+    if (phase == PHASE_ACCEL) {
+        if (ramp_index < ramp_count) {
+            entry_ticks = ramp[ramp_index].ticks;
+            entry_steps = ramp[ramp_index].steps;
+            ramp_index++;
+            return true;
+        }
+        phase = PHASE_CRUISE;
+    }
+    if (phase == PHASE_CRUISE) {
+        if (cruise_steps > 0) {
+            entry_ticks = cruise_ticks;
+            entry_steps = cruise_steps < cruise_chunk ? cruise_steps
+                                                      : cruise_chunk;
+            cruise_steps -= entry_steps;
+            return true;
+        }
+        phase = PHASE_DECEL;
+    }
+    if (phase == PHASE_DECEL) {
+        if (ramp_index > 0) {
+            ramp_index--;
+            entry_ticks = ramp[ramp_index].ticks;
+            entry_steps = ramp[ramp_index].steps;
+            return true;
+        }
+        phase = PHASE_DONE;
+    }
+    return false;
+}
+
+// the next stepper queue entry, steps slower than the longest entry
+// interval are queued one at a time behind pauses
+// returns false when the move is complete
+bool profile_next(stepper_command_s *command) {
+    if (entry_steps == 0 && !next_entry()) {
+        return false;
+    }
+    command->count_up = count_up;
+    if (entry_ticks <= PROFILE_MAX_TICKS) {
+        command->ticks = entry_ticks;
+        command->steps = entry_steps < PROFILE_MAX_STEPS ? entry_steps
+                                                         : PROFILE_MAX_STEPS;
+        unqueued_steps -= command->steps;
+        entry_steps -= command->steps;
+        return true;
+    }
+    int32_t pauses = (entry_ticks - 1) / PROFILE_MAX_TICKS;
+    uint32_t pause = entry_ticks / (pauses + 1);
+    if (entry_pauses < 0) {
+        entry_pauses = pauses;
+    }
+    if (entry_pauses > 0) {
+        command->ticks = pause;
+        command->steps = 0;
+        entry_pauses--;
+        return true;
+    }
+    command->ticks = entry_ticks - pauses * pause;
+    command->steps = 1;
+    unqueued_steps--;
+    entry_steps--;
+    entry_pauses = -1;
+    return true;
+}
+
+// decelerate from wherever the move has got to
+void profile_stop() {
+    if (phase == PHASE_ACCEL || phase == PHASE_CRUISE) {
+        unqueued_steps -= cruise_steps;
+        cruise_steps = 0;
+        if (phase == PHASE_CRUISE) {
+            ramp_index = ramp_count;
+        }
+        // the ramp down mirrors the part of the ramp up already made
+        for (int32_t i = ramp_index; i < ramp_count; i++) {
+            unqueued_steps -= 2 * ramp[i].steps;
+        }
+        phase = PHASE_DECEL;
+    }
+}
+
+// abandon the move, returns the steps that were never queued
+int32_t profile_cancel() {
+    int32_t steps = unqueued_steps;
+    phase = PHASE_DONE;
+    entry_steps = 0;
+    entry_pauses = -1;
+    unqueued_steps = 0;
+    return count_up ? steps : -steps;
+}
+
+bool profile_active() { return phase != PHASE_DONE || entry_steps > 0; }
+
+// time in seconds for a move of steps, with the FastAccelStepper ramp if
+// jerk is 0, cheap enough to work out on every gui update
+float profile_time(int32_t steps, uint32_t speed, uint32_t accel,
+                   uint32_t jerk) {
+    float distance = steps < 0 ? -steps : steps;
+    if (distance == 0 || speed == 0 || accel == 0) {
+        return 0;
+    }
+    float v = speed;
+    if (jerk == 0) {
+        if (distance * accel >= v * v) {
+            return distance / v + v / accel;
+        }
+        return 2 * sqrtf(distance / accel);
+    }
+    ramp_t timing;
+    plan_ramp(&timing, distance, speed, accel, jerk);
+    // ramps of less than a step are made at full speed
+    if (distance > 1 && timing.speed * timing.time < 1) {
+        return distance / timing.speed;
+    }
+    // the ramps average half speed so they take a ramp time more than a
+    // move at full speed
+    return timing.time + distance / timing.speed;
+}
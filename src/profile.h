@@ -0,0 +1,35 @@
+// Rotary Table jerk limited profile
+//
+// plans an s-curve move where the acceleration ramps up and down at the
+// jerk limit instead of switching on and off, the ramp to full speed is
+// worked out once per move as a table of step intervals and played
+// backwards for the deceleration, the table is turned into stepper queue
+// entries a few at a time as the queue empties
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "motion_task.h"
+#include <stdint.h>
+
+#define PROFILE_ENTRIES 256             // most entries in a ramp table
+#define PROFILE_SLICE 0.002f            // shortest queue entry in seconds
+#define PROFILE_MAX_TICKS 65535         // longest step interval in an entry
+#define PROFILE_MAX_STEPS 255           // most steps in an entry
+
+// a run of steps at a fixed interval
+struct profile_entry_t {
+    uint32_t ticks; // ticks between steps
+    uint16_t steps; // number of steps
+};
+
+bool profile_start(int32_t steps, uint32_t speed, uint32_t accel,
+                   uint32_t jerk);
+bool profile_next(stepper_command_s *command);
+void profile_stop();
+int32_t profile_cancel();
+bool profile_active();
+float profile_time(int32_t steps, uint32_t speed, uint32_t accel,
+                   uint32_t jerk);
+
+#endif
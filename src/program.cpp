@@ -0,0 +1,151 @@
+// Rotary Table stored programs
+
+#include "program.h"
+#include "crc.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Preferences.h>
+#endif
+
+program_t loaded_program; // program being stepped through or uploaded
+int32_t program_slot;     // slot it was loaded from, 0 for none
+
+static int64_t span;     // last angle from the first, unwrapped
+static uint32_t version; // changes with the loaded program
+
+#if defined(ARDUINO)
+static Preferences prefs;
+static bool opened; // prefs has been begun
+#else
+static program_t slots[PROGRAM_SLOTS]; // stored programs
+#endif
+
+// the move from one angle to the next, in the program direction or the
+// shortest way, the same angle again is no move
+int64_t program_move(angle_t from, angle_t to, int32_t direction) {
+    if (direction > 0) {
+        return (angle_t)(to - from);
+    } else if (direction < 0) {
+        return -(int64_t)(angle_t)(from - to);
+    }
+    return (int32_t)(to - from);
+}
+
+// start a new program in memory, it isn't used until it is saved
+void program_begin(int32_t direction, const char *name) {
+    memset(&loaded_program, 0, offsetof(program_t, angles));
+    loaded_program.version = PROGRAM_VERSION;
+    loaded_program.direction = direction;
+    strncpy(loaded_program.name, name, PROGRAM_NAME_SIZE - 1);
+    program_slot = 0;
+    span = 0;
+    version++;
+}
+
+// add an angle to the end of the program
+// returns false if it is full or the angle is too far from the first
+bool program_append(angle_t angle) {
+    program_t &program = loaded_program;
+    int64_t next = span;
+    if (program.count) {
+        next += program_move(program.angles[program.count - 1], angle,
+                             program.direction);
+    }
+    if (program.count == PROGRAM_MAX_ANGLES ||
+        next > PROGRAM_MAX_TURNS * ANGLE_TURN ||
+        next < -PROGRAM_MAX_TURNS * ANGLE_TURN) {
+        return false;
+    }
+    program.angles[program.count++] = angle;
+    span = next;
+    version++;
+    return true;
+}
+
+// bytes of a program that are stored
+static size_t stored_size(const program_t &program) {
+    return offsetof(program_t, angles) + program.count * sizeof(angle_t);
+}
+
+// CRC of the stored bytes with the crc itself as 0
+static uint32_t program_crc(program_t &program) {
+    uint32_t crc = program.crc;
+    program.crc = 0;
+    uint32_t result = crc32(&program, stored_size(program));
+    program.crc = crc;
+    return result;
+}
+
+#if defined(ARDUINO)
+// the NVS key of a slot
+static const char *slot_key(int32_t slot) {
+    static char key[8];
+    if (!opened) {
+        prefs.begin("programs", false);
+        opened = true;
+    }
+    snprintf(key, sizeof(key), "prog%d", (int)slot);
+    return key;
+}
+#endif
+
+// save the program in memory to a slot, it is then the loaded program
+// returns false if it is empty or could not be saved
+bool program_save(int32_t slot) {
+    program_t &program = loaded_program;
+    if (slot < 1 || slot > PROGRAM_SLOTS || program.count == 0) {
+        return false;
+    }
+    program.crc = program_crc(program);
+#if defined(ARDUINO)
+    size_t size = stored_size(program);
+    if (prefs.putBytes(slot_key(slot), &program, size) != size) {
+        return false;
+    }
+#else
+    slots[slot - 1] = program;
+#endif
+    program_slot = slot;
+    version++;
+    return true;
+}
+
+// load the program in a slot, a slot with no good program leaves none
+// loaded
+// returns false if there is no good program
+bool program_load(int32_t slot) {
+    program_t &program = loaded_program;
+    if (slot < 1 || slot > PROGRAM_SLOTS) {
+        program_unload();
+        return false;
+    }
+#if defined(ARDUINO)
+    size_t length = prefs.getBytes(slot_key(slot), &program, sizeof(program));
+#else
+    program = slots[slot - 1];
+    size_t length = stored_size(program);
+#endif
+    if (length < offsetof(program_t, angles) ||
+        program.version != PROGRAM_VERSION || program.count == 0 ||
+        program.count > PROGRAM_MAX_ANGLES ||
+        length != stored_size(program) || program.crc != program_crc(program)) {
+        program_unload();
+        return false;
+    }
+    program.name[PROGRAM_NAME_SIZE - 1] = 0;
+    program_slot = slot;
+    version++;
+    return true;
+}
+
+// step through evenly spaced divisions again
+void program_unload() {
+    loaded_program.count = 0;
+    program_slot = 0;
+    version++;
+}
+
+// bumped on each change so plans made with the old program can be redone
+uint32_t program_version() { return version; }
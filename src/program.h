@@ -0,0 +1,48 @@
+// Rotary Table stored programs
+//
+// a program is a named list of angles to step through in place of evenly
+// spaced divisions, for bolt circles with irregular spacing and cam
+// profiles, the division planner turns the loaded list into a table of
+// step targets once so stepping through it is all integer math
+//
+// programs are kept one to a slot, each one a small header and then the
+// angles as 2^32 turn units, only the loaded program is held in memory,
+// on the ESP32 the slots are NVS blobs and in the simulator they are held
+// in memory
+
+#ifndef PROGRAM_H
+#define PROGRAM_H
+
+#include "motion.h"
+#include <stdint.h>
+
+#define PROGRAM_VERSION 1                      // bump when the format changes
+#define PROGRAM_SLOTS 8                        // stored programs, 1 up
+#define PROGRAM_NAME_SIZE 16                   // longest name and a 0
+#define PROGRAM_MAX_ANGLES (MAX_DIVISIONS + 1) // most angles in a program
+#define PROGRAM_MAX_TURNS 16                   // furthest from the first
+
+// a program as it is stored, only count angles are stored, there is no
+// padding so the CRC covers only set bytes
+struct program_t {
+    uint16_t version;                   // PROGRAM_VERSION
+    uint16_t count;                     // angles in the list
+    int32_t direction;                  // moves go this way, 0 shortest
+    char name[PROGRAM_NAME_SIZE];       // shown on the division screen
+    uint32_t crc;                       // of the rest and the angles
+    angle_t angles[PROGRAM_MAX_ANGLES]; // angles in order
+};
+
+// the program being stepped through or uploaded
+extern program_t loaded_program;
+extern int32_t program_slot; // slot it was loaded from, 0 for none
+
+int64_t program_move(angle_t from, angle_t to, int32_t direction);
+void program_begin(int32_t direction, const char *name);
+bool program_append(angle_t angle);
+bool program_save(int32_t slot);
+bool program_load(int32_t slot);
+void program_unload();
+uint32_t program_version();
+
+#endif
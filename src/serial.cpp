@@ -0,0 +1,664 @@
+// Rotary Table serial protocol
+
+#include "serial.h"
+#include "estop.h"
+#include "motion.h"
+#include "pitch.h"
+#include "program.h"
+#include "spsc_queue.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+// commands for the ui task
+enum SERIAL_COMMAND {
+    SERIAL_ANSWER,       // nothing to run, answer with error, NULL for ok
+    SERIAL_REPORT,       // report the positions once the moves are done
+    SERIAL_FIRMWARE,     // report the firmware name
+    SERIAL_MOVE_TO,      // move the axes to value, unwrapped angles
+    SERIAL_MOVE_BY,      // move the axes by value angles
+    SERIAL_DWELL,        // wait for value mS
+    SERIAL_OUTPUT,       // set the trigger output to value
+    SERIAL_SET_POSITION, // set the axis positions to value angles
+    SERIAL_CLEAR_ALARM,  // clear a latched alarm
+    SERIAL_PROGRAM_NEW,  // start program name in slot value[0], direction
+                         // value[1]
+    SERIAL_PROGRAM_ADD,  // add angle value[0] to the program
+    SERIAL_PROGRAM_SAVE, // save the program to its slot and load it
+    SERIAL_PROGRAM_LOAD, // load the program in slot value[0], 0 for none
+};
+
+struct serial_command_t {
+    uint8_t type;                 // SERIAL_COMMAND
+    uint8_t axes;                 // bit for each axis in a move or position
+    int64_t value[MOTION_AXES];   // command argument, for each axis
+    char name[PROGRAM_NAME_SIZE]; // program name from a comment
+    const char *error;            // answer of SERIAL_ANSWER
+};
+
+// parsed lines from the serial task to the ui task
+static SpscQueue<serial_command_t, SERIAL_QUEUE_SIZE> lines;
+static std::atomic<bool> stop_request{false}; // ! received
+
+// line parser, only used by the serial task
+static char line[SERIAL_LINE_SIZE]; // line being received
+static uint32_t length;             // characters in line
+static bool received;               // anything since the last line end
+static bool overflow;               // line is too long
+static char comment;                // character ending a comment, or 0
+static bool relative;               // G91 moves
+static char comment_text[PROGRAM_NAME_SIZE]; // start of the first comment
+static uint32_t comment_length;              // characters in comment_text
+static bool commented;                       // a comment has ended
+static serial_write_t write_reply = NULL;
+
+// moves, only used by the ui task
+static serial_command_t pending; // command waiting for room to run
+static bool is_pending;          // pending is set
+static bool synced;              // planned position is set
+static int64_t planned_angle[MOTION_AXES]; // angle after the queued moves
+static int32_t planned_steps[MOTION_AXES]; // steps after the queued moves
+static int32_t new_program_slot;           // slot for the program being sent
+static uint8_t reported_alarm;             // alarm last reported
+
+#if defined(ARDUINO)
+static TaskHandle_t serial_task_handle = NULL;
+static TaskHandle_t notify_task_handle = NULL; // runs serial_service()
+#endif
+
+static void reply(const char *text) {
+    if (write_reply) {
+        write_reply(text);
+    }
+}
+
+// answer a line with ok or the error
+static void reply_result(const char *error) {
+    if (error) {
+        char text[48];
+        snprintf(text, sizeof(text), "error: %s\n", error);
+        reply(text);
+    } else {
+        reply("ok\n");
+    }
+}
+
+// the task that runs serial_service() has something to do
+static void wake_ui() {
+#if defined(ARDUINO)
+    if (notify_task_handle) {
+        xTaskNotifyGive(notify_task_handle);
+    }
+#endif
+}
+
+// the pitch map is only for the table, axis 0
+static int32_t axis_offset(int32_t axis, angle_t table) {
+    return axis == 0 ? pitch_offset(table) : 0;
+}
+
+static angle_t axis_table(int32_t axis, angle_t motor) {
+    return axis == 0 ? pitch_to_table(motor) : motor;
+}
+
+// report the axis positions from the status snapshot, the axes are A, B
+// and so on
+static void report_position(bool status) {
+    motion_status_t motion;
+    motion_get_status(&motion);
+    char text[96];
+    int used = 0;
+    if (status) {
+        const char *state = motion.running || motion.program ? "Run" : "Idle";
+        if (motion.alarm != MOTION_ALARM_NONE) {
+            state = "Alarm";
+        }
+        used = snprintf(text, sizeof(text), "<%s", state);
+    }
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        float degrees = angle_to_degrees(axis_table(
+            axis, axis_steps_to_angle(axis, motion.position[axis])));
+        used += snprintf(text + used, sizeof(text) - used,
+                         status ? "|%c:%.4f" : "%c:%.4f ", 'A' + axis,
+                         degrees);
+    }
+    if (!status) {
+        used += snprintf(text + used, sizeof(text) - used, "steps:%d",
+                         (int)motion.position[0]);
+        for (int32_t axis = 1; axis < MOTION_AXES; axis++) {
+            used += snprintf(text + used, sizeof(text) - used, ",%d",
+                             (int)motion.position[axis]);
+        }
+    }
+    snprintf(text + used, sizeof(text) - used, status ? ">\n" : "\n");
+    reply(text);
+}
+
+// convert degrees to an unwrapped angle
+static int64_t angle_of(double degrees) {
+    return llround(degrees * (ANGLE_TURN / 360.0));
+}
+
+// parse a decimal number with an optional sign and point, G-code has no
+// exponents or hex so strtod() would take too much
+// returns false if there are no digits
+static bool parse_number(char **text, double *number) {
+    char *c = *text;
+    double sign = 1;
+    if (*c == '-' || *c == '+') {
+        sign = *c++ == '-' ? -1 : 1;
+    }
+    double value = 0;
+    double scale = 0; // place of the next digit after the point
+    bool digits = false;
+    for (;; c++) {
+        if (isdigit((unsigned char)*c)) {
+            if (scale) {
+                value += (*c - '0') * scale;
+                scale /= 10;
+            } else {
+                value = value * 10 + (*c - '0');
+            }
+            digits = true;
+        } else if (*c == '.' && !scale) {
+            scale = 0.1;
+        } else {
+            break;
+        }
+    }
+    *text = c;
+    *number = sign * value;
+    return digits;
+}
+
+// parse a line of letter and number words into command, spaces and
+// comments are already gone
+// returns an error or NULL if it is ok
+static const char *parse_line(serial_command_t *out) {
+    int32_t motion = -1; // G0 or G4
+    int32_t code = -1;   // M code
+    bool set_position = false;
+    bool has_p = false;
+    bool has_s = false;
+    double p = 0;
+    double s = 0;
+    serial_command_t command = {};
+    char *c = line;
+    if (strcmp(line, "$X") == 0) {
+        code = 999; // the grbl unlock
+        c += 2;
+    }
+    while (*c) {
+        char letter = *c++;
+        double number;
+        if (!parse_number(&c, &number)) {
+            return "bad number";
+        }
+        switch (letter) {
+        case 'G':
+            if (number == 0 || number == 1) {
+                motion = 0;
+            } else if (number == 4) {
+                motion = 4;
+            } else if (number == 90) {
+                relative = false;
+            } else if (number == 91) {
+                relative = true;
+            } else if (number == 92) {
+                set_position = true;
+            } else {
+                return "unsupported G code";
+            }
+            break;
+        case 'M':
+            if (code >= 0) {
+                return "more than one M code";
+            }
+            if (number < 0 || number > SERIAL_MAX_CODE ||
+                number != floor(number)) {
+                return "bad M code";
+            }
+            code = number;
+            break;
+        case 'P':
+            p = number;
+            has_p = true;
+            break;
+        case 'S':
+            s = number;
+            has_s = true;
+            break;
+        case 'F': // moves are at the speed set on the screen
+        case 'N': // line number
+            break;
+        default:
+            // an axis word, A for the table then B and so on
+            if (letter < 'A' || letter >= 'A' + MOTION_AXES) {
+                return "unsupported word";
+            }
+            if (fabs(number) > SERIAL_MAX_DEGREES) {
+                return "angle out of range";
+            }
+            command.axes |= 1 << (letter - 'A');
+            command.value[letter - 'A'] = angle_of(number);
+        }
+    }
+    if ((code >= 0) + (motion >= 0) + set_position > 1) {
+        return "more than one command";
+    }
+    if (set_position) {
+        if (!command.axes) {
+            return "no axis";
+        }
+        command.type = SERIAL_SET_POSITION;
+    } else if (motion == 4) {
+        if (!has_p || p < 0 || p * 1000 > MAX_DWELL) {
+            return "bad P";
+        }
+        command.type = SERIAL_DWELL;
+        command.value[0] = llround(p * 1000);
+    } else if (motion == 0 && command.axes) {
+        command.type = relative ? SERIAL_MOVE_BY : SERIAL_MOVE_TO;
+    } else if (code == 62 || code == 63) {
+        if (!has_p || p != 0) {
+            return "bad P";
+        }
+#if TRIGGER_PIN >= 0
+        command.type = SERIAL_OUTPUT;
+        command.value[0] = code == 62;
+#else
+        return "no trigger output";
+#endif
+    } else if (code == 114) {
+        command.type = SERIAL_REPORT;
+    } else if (code == 115) {
+        command.type = SERIAL_FIRMWARE;
+    } else if (code == 700) {
+        if (!has_p || p < 1 || p > PROGRAM_SLOTS || p != (int32_t)p) {
+            return "bad P";
+        }
+        if (has_s && s != 1 && s != 0 && s != -1) {
+            return "bad S";
+        }
+        command.type = SERIAL_PROGRAM_NEW;
+        command.value[0] = p;
+        command.value[1] = has_s ? s : 1;
+        memcpy(command.name, comment_text, sizeof(command.name));
+    } else if (code == 701) {
+        if (command.axes != 1) {
+            return "no axis";
+        }
+        command.type = SERIAL_PROGRAM_ADD;
+    } else if (code == 702) {
+        command.type = SERIAL_PROGRAM_SAVE;
+    } else if (code == 999) {
+        command.type = SERIAL_CLEAR_ALARM;
+    } else if (code == 703) {
+        if (!has_p || p < 0 || p > PROGRAM_SLOTS || p != (int32_t)p) {
+            return "bad P";
+        }
+        command.type = SERIAL_PROGRAM_LOAD;
+        command.value[0] = p;
+    } else if (code < 0 || code == 0 || code == 2 || code == 30) {
+        command.type = SERIAL_ANSWER; // nothing to run
+    } else {
+        return "unsupported M code";
+    }
+    *out = command;
+    return NULL;
+}
+
+// there is room to queue another line
+bool serial_ready() { return lines.space() > 0; }
+
+// take a character from the host, only call with a line ending when
+// serial_ready() so the line can be queued, ? and ! are acted on straight
+// away wherever they are, every line is queued, errors too, and answered
+// by the ui task as it runs so the answers keep to the order of the lines
+void serial_input(char c) {
+    if (c == '!') {
+        stop_request.store(true);
+        wake_ui();
+        return;
+    }
+    if (c == '?') {
+        report_position(true);
+        return;
+    }
+    if (c == '\n' || c == '\r') {
+        if (received) {
+            line[length] = 0;
+            serial_command_t command;
+            const char *error =
+                overflow ? "line too long" : parse_line(&command);
+            if (error) {
+                command = {};
+                command.type = SERIAL_ANSWER;
+                command.error = error;
+            }
+            lines.push(command);
+            wake_ui();
+        }
+        length = 0;
+        received = false;
+        overflow = false;
+        comment = 0;
+        memset(comment_text, 0, sizeof(comment_text));
+        comment_length = 0;
+        commented = false;
+        return;
+    }
+    received = true;
+    if (comment) {
+        if (c == comment) {
+            comment = 0;
+            commented = true;
+        } else if (!commented && comment_length < PROGRAM_NAME_SIZE - 1) {
+            comment_text[comment_length++] = c; // as it is, not upper case
+        }
+    } else if (c == '(') {
+        comment = ')';
+    } else if (c == ';') {
+        comment = '\n'; // to the end of the line
+    } else if (c == '%') {
+        // program start and end markers
+    } else if (!isspace((unsigned char)c)) {
+        if (length < SERIAL_LINE_SIZE - 1) {
+            line[length++] = toupper((unsigned char)c);
+        } else {
+            overflow = true;
+        }
+    }
+}
+
+void serial_set_writer(serial_write_t writer) { write_reply = writer; }
+
+// queue a move from the end of the moves before it, the pitch correction
+// and the rounding to a step are worked out from the planned step position
+// so the rounding never builds up, a move of more than one axis is a
+// synchronised move
+// returns an error or NULL if it is queued
+static const char *queue_move(const serial_command_t &command) {
+    int64_t angle[MOTION_AXES];
+    int32_t steps[MOTION_AXES];
+    int32_t moving = 0; // axes with steps to move
+    int32_t last = 0;   // last axis with steps
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        angle[axis] = planned_angle[axis];
+        if (command.axes & 1 << axis) {
+            angle[axis] = command.value[axis];
+            if (command.type == SERIAL_MOVE_BY) {
+                angle[axis] += planned_angle[axis];
+            }
+        }
+        angle_t from = planned_angle[axis];
+        angle_t to = angle[axis];
+        int32_t error = (angle_t)(from + axis_offset(axis, from)) -
+                        axis_steps_to_angle(axis, planned_steps[axis]);
+        int64_t motor = angle[axis] - planned_angle[axis] +
+                        axis_offset(axis, to) - axis_offset(axis, from) +
+                        error;
+        // a stream of relative moves can leave an absolute move too far
+        if (motor > 2 * angle_of(SERIAL_MAX_DEGREES) ||
+            motor < -2 * angle_of(SERIAL_MAX_DEGREES)) {
+            return "move out of range";
+        }
+        steps[axis] = axis_angle_to_steps(axis, motor);
+        if (steps[axis]) {
+            moving++;
+            last = axis;
+        }
+    }
+    if (moving == 1) {
+        // a run of moves the same way goes through without stopping
+        motion_program_post(MOTION_BLEND, steps[last], last);
+    } else if (moving > 1) {
+        for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+            if (steps[axis]) {
+                motion_program_post(MOTION_SYNC_STEPS, steps[axis], axis);
+            }
+        }
+        motion_program_post(MOTION_SYNC_MOVE);
+    }
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        planned_angle[axis] = angle[axis];
+        planned_steps[axis] += steps[axis];
+    }
+    return NULL;
+}
+
+// report the loaded program
+static void report_program() {
+    char text[64];
+    if (program_slot) {
+        snprintf(text, sizeof(text), "program %d: %s, %d angles\n",
+                 (int)program_slot, loaded_program.name,
+                 (int)loaded_program.count);
+    } else {
+        snprintf(text, sizeof(text), "program 0: divisions\n");
+    }
+    reply(text);
+}
+
+// change the program, the division table is replanned from it so it waits
+// until the moves before it are done, a save also waits as a flash write
+// can hold up the ui task
+// returns false if it has to wait, otherwise error is set or NULL
+static bool program_command(const serial_command_t &command,
+                            const char **error) {
+    motion_status_t status;
+    motion_get_status(&status);
+    if (status.running || !motion_program_idle(status)) {
+        return false;
+    }
+    switch (command.type) {
+    case SERIAL_PROGRAM_NEW:
+        program_begin(command.value[1], command.name);
+        new_program_slot = command.value[0];
+        break;
+    case SERIAL_PROGRAM_ADD:
+        if (!new_program_slot || program_slot) {
+            *error = "no program started";
+        } else if (!program_append(command.value[0])) {
+            *error = "program too long";
+        }
+        break;
+    case SERIAL_PROGRAM_SAVE:
+        if (!new_program_slot || program_slot ||
+            !program_save(new_program_slot)) {
+            *error = "program not saved";
+        } else {
+            report_program();
+        }
+        new_program_slot = 0;
+        break;
+    case SERIAL_PROGRAM_LOAD:
+        if (command.value[0] == 0) {
+            program_unload();
+        } else if (!program_load(command.value[0])) {
+            *error = "no program";
+        }
+        new_program_slot = 0;
+        if (!*error) {
+            report_program();
+        }
+        break;
+    }
+    return true;
+}
+
+// clear a latched alarm once the axes have stopped, it is answered once
+// the motion task has cleared it so the lines after it aren't refused
+// returns false until then, otherwise error is set or NULL
+static bool clear_alarm(const motion_status_t &status, const char **error) {
+    if (status.alarm == MOTION_ALARM_NONE) {
+        return true;
+    }
+    if (status.alarm == MOTION_ALARM_ESTOP && estop_pressed()) {
+        *error = "stop pressed";
+        return true;
+    }
+    if (!status.running) {
+        motion_post(MOTION_CLEAR_ALARM);
+    }
+    return false;
+}
+
+// run a command, nothing is queued for the motion program while an alarm
+// holds it off as it would only be dropped
+// returns false if it has to wait for room in the program for the longest
+// command, a synchronised move, or for the moves before a report to be
+// done, otherwise error is set or NULL
+static bool execute(const serial_command_t &command, const char **error) {
+    *error = NULL;
+    motion_status_t status;
+    motion_get_status(&status);
+    switch (command.type) {
+    case SERIAL_ANSWER:
+        *error = command.error;
+        return true;
+    case SERIAL_REPORT:
+        // where the moves before it took the axes
+        if (status.running || !motion_program_idle(status)) {
+            return false;
+        }
+        report_position(false);
+        return true;
+    case SERIAL_FIRMWARE:
+        reply("FIRMWARE:Rotary Table V0.1\n");
+        return true;
+    }
+    if (command.type >= SERIAL_PROGRAM_NEW) {
+        return program_command(command, error);
+    }
+    if (motion_program_space() < MOTION_AXES + 1) {
+        return false;
+    }
+    if (command.type == SERIAL_CLEAR_ALARM) {
+        return clear_alarm(status, error);
+    }
+    if (status.alarm != MOTION_ALARM_NONE) {
+        *error = "alarm";
+        return true;
+    }
+    switch (command.type) {
+    case SERIAL_MOVE_TO:
+    case SERIAL_MOVE_BY:
+        *error = queue_move(command);
+        break;
+    case SERIAL_DWELL:
+        motion_program_post(MOTION_DWELL, command.value[0]);
+        break;
+    case SERIAL_OUTPUT:
+#if TRIGGER_PIN >= 0
+        motion_program_post(MOTION_OUTPUT,
+                            TRIGGER_PIN << 1 | command.value[0]);
+#endif
+        break;
+    case SERIAL_SET_POSITION:
+        for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+            if (command.axes & 1 << axis) {
+                angle_t table = command.value[axis];
+                int32_t steps = axis_angle_to_steps(
+                    axis, (angle_t)(table + axis_offset(axis, table)));
+                motion_program_post(MOTION_SET_POSITION, steps, axis);
+                planned_angle[axis] = command.value[axis];
+                planned_steps[axis] = steps;
+            }
+        }
+        break;
+    }
+    return true;
+}
+
+// run the lines queued by the serial task, a division cycle has the motion
+// program to itself until it is done
+// returns true while a line is waiting to run
+bool serial_service() {
+    motion_status_t status;
+    motion_get_status(&status);
+    if (stop_request.exchange(false)) {
+        while (lines.pop(pending)) {
+        }
+        is_pending = false;
+        synced = false;
+        motion_jog_continuous(0);
+    }
+    // the moves already answered have been dropped
+    if (status.alarm != reported_alarm) {
+        if (status.alarm == MOTION_ALARM_STALL) {
+            reply("ALARM: lost steps\n");
+        } else if (status.alarm == MOTION_ALARM_ESTOP) {
+            reply("ALARM: emergency stop\n");
+        }
+        reported_alarm = status.alarm;
+    }
+    // an axis has been moved some other way so start from where it is
+    if (!status.running && motion_program_idle(status)) {
+        for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+            if (!synced || status.position[axis] != planned_steps[axis]) {
+                angle_t table = axis_table(
+                    axis, axis_steps_to_angle(axis, status.position[axis]));
+                planned_angle[axis] +=
+                    (int32_t)(table - (angle_t)planned_angle[axis]);
+                planned_steps[axis] = status.position[axis];
+            }
+        }
+        synced = true;
+    }
+    for (;;) {
+        if (!is_pending) {
+            if (!lines.pop(pending)) {
+                return false;
+            }
+            is_pending = true;
+        }
+        const char *error;
+        if (motion_program_running() || !execute(pending, &error)) {
+            return true;
+        }
+        reply_result(error);
+        is_pending = false;
+    }
+}
+
+#if defined(ARDUINO)
+static void serial_write(const char *text) { Serial.print(text); }
+
+// characters have arrived
+static void serial_receive() {
+    if (serial_task_handle) {
+        xTaskNotifyGive(serial_task_handle);
+    }
+}
+
+// read characters while there is room to queue a line, ? and ! are read
+// whenever they are next, it sleeps until more arrive or polls every tick
+// for room while a line is held back
+static void serial_task(void *parameter) {
+    for (;;) {
+        while (Serial.available()) {
+            int c = Serial.peek();
+            if (!serial_ready() && c != '!' && c != '?') {
+                break;
+            }
+            serial_input(Serial.read());
+        }
+        ulTaskNotifyTake(pdTRUE, Serial.available() ? 1 : portMAX_DELAY);
+    }
+}
+
+void serial_task_start() {
+    serial_set_writer(serial_write);
+    xTaskCreatePinnedToCore(serial_task, "serial", 4096, NULL, 1,
+                            &serial_task_handle, SERIAL_TASK_CORE);
+    Serial.onReceive(serial_receive);
+}
+
+// the task that calls serial_service()
+void serial_notify_task(TaskHandle_t task) { notify_task_handle = task; }
+#endif
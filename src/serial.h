@@ -0,0 +1,65 @@
+// Rotary Table serial protocol
+//
+// a line based, G-code like protocol so a CNC controller can drive the
+// table as its A axis and the tilt as its B axis, characters are parsed as
+// they arrive into a fixed line buffer by the serial task and every line,
+// one with an error too, is queued for the ui task, which answers each
+// with "ok" or "error: <reason>" in turn so the answers come in the order
+// of the lines, moves are run through the motion program so a stream of
+// lines runs back to back, a move out of range or one sent while an alarm
+// is latched gets an error, and "ALARM: <reason>" is sent as an alarm
+// latches, dropping the moves queued before it
+//
+//   G0 A<deg> B<deg>      move, both axes start and finish together, G1
+//                         is the same and F is accepted and ignored, a
+//                         move of one axis the same way as the one
+//                         before it joins it without stopping
+//   G4 P<sec>             dwell
+//   G90, G91              absolute or relative moves, angles are not wrapped
+//   G92 A<deg> B<deg>     set positions once the moves before them stop
+//   M62 P0, M63 P0        trigger output on or off in step with the moves
+//   M114                  report "A:<deg> B:<deg> steps:<steps>,<steps>"
+//                         once the moves before it are done
+//   M115                  report the firmware name
+//   M700 P<slot> S<dir> (name)
+//                         start a program for a slot, S1 moves forward,
+//                         S-1 backward and S0 the shortest way
+//   M701 A<deg>           add an angle to the program
+//   M702                  save the program and load it, the reply is
+//                         "program <slot>: <name>, <count> angles"
+//   M703 P<slot>          load a program, P0 for evenly spaced divisions
+//   M999, $X              clear a latched alarm, the table takes the
+//                         position the encoder measured
+//   ?                     report "<Idle|A:<deg>|B:<deg>>" or "<Run|..."
+//   !                     stop and drop any queued moves
+//
+// ? and ! are acted on straight away, even in the middle of a line
+
+#ifndef SERIAL_H
+#define SERIAL_H
+
+#include <stdint.h>
+#if defined(ARDUINO)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#define SERIAL_LINE_SIZE 96     // longest line, comments included
+#define SERIAL_QUEUE_SIZE 8     // lines waiting for the ui task
+#define SERIAL_MAX_DEGREES 9999 // largest axis angle
+#define SERIAL_MAX_CODE 999     // largest M code
+#define SERIAL_TASK_CORE 0      // shares the ui core
+
+// writes a reply to the host
+typedef void (*serial_write_t)(const char *text);
+
+bool serial_ready();
+void serial_input(char c);
+bool serial_service();
+void serial_set_writer(serial_write_t writer);
+#if defined(ARDUINO)
+void serial_task_start();
+void serial_notify_task(TaskHandle_t task);
+#endif
+
+#endif
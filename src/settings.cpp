@@ -0,0 +1,182 @@
+// Rotary Table settings
+
+#include "settings.h"
+#include "crc.h"
+#include "motion.h"
+#include "pitch.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <stddef.h>
+#include <string.h>
+
+// drive settings of an axis after the table
+struct axis_settings_t {
+    int32_t steps_per_rev; // motor steps per motor revolution
+    float degrees_per_rev; // axis degrees per motor revolution
+    int32_t micro_steps;   // driver microstep setting
+};
+
+// settings as they are stored, the drive settings are the table's
+struct settings_t {
+    uint16_t version;                      // SETTINGS_VERSION
+    uint16_t size;                         // size of settings_t
+    int64_t relative_move;                 // user defined relative move
+    angle_t absolute_position;             // position for absolute move
+    int32_t steps_per_rev;                 // motor steps per motor revolution
+    float degrees_per_rev;                 // table degrees per motor revolution
+    int32_t micro_steps;                   // driver microstep setting
+    int32_t degrees_per_sec;               // velocity in degrees per second
+    int32_t degrees_accel;                 // acceleration in degrees per sec ^2
+    int32_t degrees_jerk;                  // jerk in degrees per sec ^3, 0 off
+    int32_t division_dwell;                // dwell at each division in mS
+    int32_t backlash_steps;                // steps of backlash in the drive
+    int32_t approach_direction;            // end moves this way, 0 for either
+    int16_t pitch_map[PITCH_POINTS];       // pitch error map in arc seconds
+    axis_settings_t axes[MOTION_AXES - 1]; // the other axes
+    angle_t home_offset;                   // angle of the home switch edge
+    int32_t feedback_counts;               // encoder counts per table turn
+    uint32_t crc;                          // of everything before it
+};
+
+// keys used before the settings were one blob
+static const char *old_keys[] = {
+    "relativeMove", "absolutePos", "stepsRev", "degreesRev",
+    "microSteps",   "degSec",      "degAcc",   "degJerk",
+    "divDwell",     "backlash",    "approach", "pitchMap",
+};
+
+static Preferences prefs;
+static settings_t stored;     // settings in NVS
+static bool dirty;            // the settings have changed
+static uint32_t changed_time; // time in mS of the last change
+
+// copy the settings from the motion variables
+static void gather(settings_t *settings) {
+    memset(settings, 0, sizeof(*settings));
+    settings->version = SETTINGS_VERSION;
+    settings->size = sizeof(*settings);
+    settings->relative_move = relative_move;
+    settings->absolute_position = absolute_position;
+    settings->steps_per_rev = axis_config[0].steps_per_rev;
+    settings->degrees_per_rev = axis_config[0].degrees_per_rev;
+    settings->micro_steps = axis_config[0].micro_steps;
+    settings->degrees_per_sec = degrees_per_sec;
+    settings->degrees_accel = degrees_accel;
+    settings->degrees_jerk = degrees_jerk;
+    settings->division_dwell = division_dwell;
+    settings->backlash_steps = backlash_steps;
+    settings->approach_direction = approach_direction;
+    memcpy(settings->pitch_map, pitch_map, sizeof(pitch_map));
+    for (int32_t axis = 1; axis < MOTION_AXES; axis++) {
+        axis_settings_t &other = settings->axes[axis - 1];
+        other.steps_per_rev = axis_config[axis].steps_per_rev;
+        other.degrees_per_rev = axis_config[axis].degrees_per_rev;
+        other.micro_steps = axis_config[axis].micro_steps;
+    }
+    settings->home_offset = home_offset;
+    settings->feedback_counts = feedback_counts;
+    settings->crc = crc32(settings, offsetof(settings_t, crc));
+}
+
+// copy the settings to the motion variables
+static void apply(const settings_t *settings) {
+    relative_move = settings->relative_move;
+    absolute_position = settings->absolute_position;
+    axis_config[0].steps_per_rev = settings->steps_per_rev;
+    axis_config[0].degrees_per_rev = settings->degrees_per_rev;
+    axis_config[0].micro_steps = settings->micro_steps;
+    degrees_per_sec = settings->degrees_per_sec;
+    degrees_accel = settings->degrees_accel;
+    degrees_jerk = settings->degrees_jerk;
+    division_dwell = settings->division_dwell;
+    backlash_steps = settings->backlash_steps;
+    approach_direction = settings->approach_direction;
+    memcpy(pitch_map, settings->pitch_map, sizeof(pitch_map));
+    for (int32_t axis = 1; axis < MOTION_AXES; axis++) {
+        const axis_settings_t &other = settings->axes[axis - 1];
+        axis_config[axis].steps_per_rev = other.steps_per_rev;
+        axis_config[axis].degrees_per_rev = other.degrees_per_rev;
+        axis_config[axis].micro_steps = other.micro_steps;
+    }
+    home_offset = settings->home_offset;
+    feedback_counts = settings->feedback_counts;
+}
+
+// the other axes start with the same drive as the table
+static void same_drive() {
+    for (int32_t axis = 1; axis < MOTION_AXES; axis++) {
+        axis_config[axis].steps_per_rev = axis_config[0].steps_per_rev;
+        axis_config[axis].degrees_per_rev = axis_config[0].degrees_per_rev;
+        axis_config[axis].micro_steps = axis_config[0].micro_steps;
+    }
+}
+
+// write the settings if they differ from the ones in NVS
+static void settings_write() {
+    settings_t settings;
+    gather(&settings);
+    if (memcmp(&settings, &stored, sizeof(settings)) != 0) {
+        prefs.putBytes("settings", &settings, sizeof(settings));
+        stored = settings;
+    }
+    dirty = false;
+}
+
+// read the settings, or take them from the keys used before the settings
+// blob, which default to some "reasonably sane" settings, the other axes
+// start with the table's drive
+void settings_load() {
+    prefs.begin("myApp", false);
+    settings_t settings;
+    size_t length = prefs.getBytes("settings", &settings, sizeof(settings));
+    if (length == sizeof(settings) && settings.version == SETTINGS_VERSION &&
+        settings.size == sizeof(settings) &&
+        settings.crc == crc32(&settings, offsetof(settings_t, crc))) {
+        apply(&settings);
+        stored = settings;
+        return;
+    }
+    relative_move = degrees_to_angle(prefs.getFloat("relativeMove", 90));
+    absolute_position = degrees_to_angle(prefs.getFloat("absolutePos", 90));
+    axis_config[0].steps_per_rev = prefs.getInt("stepsRev", 200);
+    axis_config[0].degrees_per_rev = prefs.getFloat("degreesRev", 5);
+    axis_config[0].micro_steps = prefs.getInt("microSteps", 4);
+    same_drive();
+    degrees_per_sec = prefs.getInt("degSec", 20);
+    degrees_accel = prefs.getInt("degAcc", 20);
+    degrees_jerk = prefs.getInt("degJerk", 0);
+    division_dwell = prefs.getInt("divDwell", 0);
+    backlash_steps = prefs.getInt("backlash", 0);
+    approach_direction = prefs.getInt("approach", 0);
+    home_offset = 0;
+    feedback_counts = 0;
+    // the pitch error map is all 0 until it is measured
+    memset(pitch_map, 0, sizeof(pitch_map));
+    if (prefs.getBytesLength("pitchMap") == sizeof(pitch_map)) {
+        prefs.getBytes("pitchMap", pitch_map, sizeof(pitch_map));
+    }
+    settings_write();
+    for (const char *key : old_keys) {
+        if (prefs.isKey(key)) {
+            prefs.remove(key);
+        }
+    }
+}
+
+// a setting has changed, it is written once the changes stop
+void settings_changed() {
+    dirty = true;
+    changed_time = millis();
+}
+
+// write the settings once they have settled and the table is stopped
+void settings_service() {
+    if (!dirty || millis() - changed_time < SETTINGS_DELAY) {
+        return;
+    }
+    motion_status_t status;
+    motion_get_status(&status);
+    if (!status.running && !status.program) {
+        settings_write();
+    }
+}
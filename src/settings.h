@@ -0,0 +1,19 @@
+// Rotary Table settings
+//
+// the settings are kept in NVS as one versioned blob with a CRC and read
+// in one go at boot, a change only marks them dirty and the ui task writes
+// them back once there have been no changes for a while and the table is
+// stopped, so a run of edits is one flash write that never happens during
+// a move, a write is skipped if nothing has really changed
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#define SETTINGS_VERSION 1  // bump when the stored settings change
+#define SETTINGS_DELAY 2000 // mS after the last change before writing
+
+void settings_load();
+void settings_changed();
+void settings_service();
+
+#endif
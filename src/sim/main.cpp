@@ -0,0 +1,311 @@
+// Rotary Table simulator
+//
+// runs random division, division program, stored program, absolute and
+// relative moves
+// through the motion logic against a simulated stepper and reports the
+// worst position error compared with the exact step position, it also
+// reports how far the move and cycle time estimates are from the simulated
+// times, the checks are in sim_checks.cpp
+//
+// each check that fails is printed with its name, the seed, the round and
+// the values it failed on, and the run exits non zero if any did
+//
+// half the settings have a random pitch error map, the table is taken to
+// follow the map exactly so it checks the correction rather than the map
+//
+// milling runs have their feed override changed at random as they move
+// and are checked to end on the mill end without turning back
+//
+// electronic gearing follows a synthetic encoder that speeds up, slows
+// down and reverses, it reports the largest lag behind the exact ratio,
+// which has to be within a bound worked out from the gearing slices, and
+// checks the table stops exactly on it, without going past it, once the
+// encoder stops
+//
+// homing runs against a flag somewhere on the table and is checked to set
+// the edge of the flag exactly on the step of the home offset
+//
+// encoder feedback runs moves on a motor that now and then slips whole
+// full step cycles, a few lost steps have to be put back so the motor ends
+// where the steps say it is, more have to raise an alarm
+//
+// the emergency stop is pressed part way through a move, not another step
+// may be made after it and nothing may move until it is released and the
+// alarm cleared
+//
+// now and then the table is tuned against a motor that stalls once it
+// goes faster or speeds up harder than a random limit, checked by the home
+// flag or the encoder, the speeds found have to be within the search
+// resolution under the limits and the table where the steps say, a motor
+// too weak to keep the least tuning stores has to be left as it was
+//
+// the microstepping and degrees per rev are changed a few times and
+// changed back, the table has to keep its angle within half a step, its
+// whole turns exactly, and come back to the same step
+//
+// stored programs of random angle lists are stepped through and run as a
+// division program like evenly spaced divisions
+//
+// synchronised moves of the table and tilt axes are checked to end on
+// target and for how close together the two axes finish
+//
+// a few lines sent to the serial protocol at once are checked to be
+// answered in the order they were sent
+//
+// built with STEP_TRACE set to 1 it steps through every move and reports
+// the step timing jitter of all of them, like the ESP32 trace build
+//
+// with -p it instead runs the serial protocol on a pseudo terminal in real
+// time, so a G-code sender can be tried against it on Linux
+//
+// with -m it instead runs a G-code program in simulated time with the
+// settings from a file and writes CSV traces of the steps and the motion
+// of each axis, see profile_run.h
+//
+// usage: rotary_sim [-n moves] [-s seed] [-k round] [-t tolerance] [-r] [-p]
+//        rotary_sim -m program [-f settings] [-o prefix] [-i interval]
+//     -n  number of moves to run, default 1000000
+//     -s  random seed, default 1
+//     -k  round to start from, default 0
+//     -t  allowed error in steps, default 0.5
+//     -r  step through every move rather than finishing it in one go
+//     -p  run the serial protocol on a pseudo terminal
+//     -m  run a G-code program, - for stdin
+//     -f  settings file for the program, default the -p settings
+//     -o  prefix of the CSV files, default profile
+//     -i  trace interval in mS, default 1
+#include "../encoder.h"
+#include "../motion.h"
+#include "../pitch.h"
+#include "../serial.h"
+#include "../step_trace.h"
+#include "profile_run.h"
+#include "sim_checks.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+// pseudo terminal for the serial protocol
+static int pty = -1;
+
+static void pty_write(const char *text) {
+    if (write(pty, text, strlen(text)) < 0) {
+        perror("pty");
+    }
+}
+
+// run the serial protocol against the simulated stepper in real time with
+// the default screen settings, until it is killed
+static int run_pty() {
+    pty = posix_openpt(O_RDWR | O_NOCTTY);
+    if (pty < 0 || grantpt(pty) < 0 || unlockpt(pty) < 0) {
+        perror("pty");
+        return 1;
+    }
+    // hold the other end open in raw mode so reads never see a hang up
+    const char *name = ptsname(pty);
+    int other = open(name, O_RDWR | O_NOCTTY);
+    struct termios mode;
+    tcgetattr(other, &mode);
+    cfmakeraw(&mode);
+    tcsetattr(other, TCSANOW, &mode);
+    fcntl(pty, F_SETFL, O_NONBLOCK);
+    printf("serial port: %s\n", name);
+    fflush(stdout);
+
+    steps_per_rev = 200;
+    micro_steps = 4;
+    degrees_per_rev = 5;
+    degrees_per_sec = 20;
+    degrees_accel = 20;
+    axis_config[1].steps_per_rev = 200;
+    axis_config[1].micro_steps = 4;
+    axis_config[1].degrees_per_rev = 5;
+    set_angle_per_step();
+    set_step_rate();
+    set_acceleration();
+    pitch_update();
+    serial_set_writer(pty_write);
+    auto start = std::chrono::steady_clock::now();
+    int next = -1; // character read but not yet taken
+    for (;;) {
+        // like the serial task, hold back lines until there is room
+        for (;;) {
+            char c;
+            if (next < 0) {
+                if (read(pty, &c, 1) != 1) {
+                    break;
+                }
+                next = c;
+            }
+            if (!serial_ready() && next != '!' && next != '?') {
+                break;
+            }
+            serial_input(next);
+            next = -1;
+        }
+        serial_service();
+        motion_service();
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        uint64_t now = elapsed.count() * TICKS_PER_S;
+        for (int axis = 0; axis < MOTION_AXES; axis++) {
+            if (now > steppers[axis]->now()) {
+                steppers[axis]->advance(now - steppers[axis]->now());
+            }
+        }
+        motion_service();
+        set_current_position();
+        usleep(1000);
+    }
+}
+
+#if STEP_TRACE
+static void print_trace(const char *text) { fputs(text, stdout); }
+#endif
+
+int main(int argc, char *argv[]) {
+    uint64_t total_moves = 1000000;
+    uint32_t seed = 1;
+    uint32_t first_round = 0;
+    bool record = false;
+    double tolerance = 0.5;
+    bool serial = false;
+    const char *program = NULL;
+    const char *settings = NULL;
+    const char *prefix = "profile";
+    double interval = PROFILE_RUN_INTERVAL;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:k:t:rpm:f:o:i:")) != -1) {
+        switch (opt) {
+        case 'n':
+            total_moves = strtoull(optarg, NULL, 10);
+            break;
+        case 's':
+            seed = strtoul(optarg, NULL, 10);
+            break;
+        case 'k':
+            first_round = strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            tolerance = atof(optarg);
+            break;
+        case 'r':
+            record = true;
+            break;
+        case 'p':
+            serial = true;
+            break;
+        case 'm':
+            program = optarg;
+            break;
+        case 'f':
+            settings = optarg;
+            break;
+        case 'o':
+            prefix = optarg;
+            break;
+        case 'i':
+            interval = atof(optarg);
+            break;
+        default:
+            fprintf(stderr,
+                    "usage: %s [-n moves] [-s seed] [-k round] [-t tolerance] "
+                    "[-r] [-p]\n"
+                    "       %s -m program [-f settings] [-o prefix] "
+                    "[-i interval]\n",
+                    argv[0], argv[0]);
+            return 2;
+        }
+    }
+    sim_begin(seed, tolerance);
+    for (int axis = 0; axis < MOTION_AXES; axis++) {
+        steppers[axis]->record = record;
+    }
+#if STEP_TRACE
+    // every step has to be simulated to be traced
+    steppers[0]->record = true;
+    step_trace_start(-1);
+#endif
+    if (serial) {
+        return run_pty();
+    }
+    if (program) {
+        return profile_run(program, settings, prefix, interval);
+    }
+
+    peaks_t plain;
+    peaks_t jerked;
+    bool peaks = profile_check(&plain, &jerked);
+    sim_circle_steps();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = first_round; sim_stats.moves < total_moves;
+         round++) {
+        sim_round(round);
+        sim_divisions();
+        sim_division_program();
+        sim_program();
+        sim_milling();
+        sim_gearing();
+        sim_homing();
+        sim_feedback();
+        sim_estop();
+        sim_absolute_moves();
+        sim_relative_moves();
+        sim_blends();
+        sim_serial_order();
+        sim_sync_moves();
+        sim_tuning();
+        sim_rescale();
+    }
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    printf("moves: %llu in %.3f s, %.0f moves/s\n",
+           (unsigned long long)sim_stats.moves, elapsed.count(),
+           sim_stats.moves / elapsed.count());
+    printf("steps: %llu, simulated time: %.1f s\n",
+           (unsigned long long)(steppers[0]->step_count +
+                                steppers[1]->step_count),
+           (double)steppers[0]->now() / TICKS_PER_S);
+    printf("max error: %.3f steps, tolerance %.3f steps\n",
+           sim_stats.max_error, tolerance);
+    printf("drive settings with the steps in a turn wrong: %u\n",
+           sim_stats.wrong_circles);
+    printf("profile peaks of a 20 deg/s, 20 deg/s^2 move: %.3f deg/s, %.3f "
+           "deg/s^2\n",
+           plain.velocity, plain.acceleration);
+    printf("and with a %d deg/s^3 jerk: %.3f deg/s, %.3f deg/s^2, %.1f "
+           "deg/s^3, %u jerk spikes\n",
+           PROFILE_CHECK_JERK, jerked.velocity, jerked.acceleration,
+           jerked.jerk, jerked.spikes);
+    printf("max time estimate error: %.2f%%\n", sim_stats.max_time_error * 100);
+    printf("max synchronised finish difference: %.2f%%\n",
+           sim_stats.max_sync_error * 100);
+    printf("max gearing lag: %.1f steps, %.0f%% of its bound, overshoot %d "
+           "steps\n",
+           sim_stats.max_gear_lag, sim_stats.max_lag_share * 100,
+           sim_stats.max_overshoot);
+    printf("lost steps: %llu moves corrected, %llu alarms\n",
+           (unsigned long long)sim_stats.corrected,
+           (unsigned long long)sim_stats.alarms);
+    printf("emergency stops: %llu, %llu steps after them, %d counted "
+           "after the cut\n",
+           (unsigned long long)sim_stats.stops,
+           (unsigned long long)sim_stats.stop_late, sim_stats.max_cut);
+    printf("tunings: %llu\n", (unsigned long long)sim_stats.tunings);
+    printf("failed checks: %u\n", sim_stats.failures);
+#if STEP_TRACE
+    step_trace_total(print_trace);
+#endif
+    if (sim_stats.failures || !peaks) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
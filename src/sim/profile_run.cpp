@@ -0,0 +1,562 @@
+// Rotary Table profile run
+
+#include "profile_run.h"
+#include "../motion.h"
+#include "../pitch.h"
+#include "../serial.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// where an axis is at a time, at each step and each start from rest
+struct point_t {
+    uint64_t ticks;   // time
+    int32_t position; // step position
+};
+
+// a setting the file can set, one of integer or real
+struct setting_t {
+    const char *name;
+    int32_t *integer;
+    float *real;
+};
+
+static const setting_t settings_list[] = {
+    {"steps_per_rev", &steps_per_rev, NULL},
+    {"micro_steps", &micro_steps, NULL},
+    {"degrees_per_rev", NULL, &degrees_per_rev},
+    {"degrees_per_sec", &degrees_per_sec, NULL},
+    {"degrees_accel", &degrees_accel, NULL},
+    {"degrees_jerk", &degrees_jerk, NULL},
+    {"backlash_steps", &backlash_steps, NULL},
+    {"approach_direction", &approach_direction, NULL},
+    {"tilt_steps_per_rev", &axis_config[1].steps_per_rev, NULL},
+    {"tilt_micro_steps", &axis_config[1].micro_steps, NULL},
+    {"tilt_degrees_per_rev", NULL, &axis_config[1].degrees_per_rev},
+};
+
+static std::vector<point_t> starts[MOTION_AXES]; // each start from rest
+static bool was_running[MOTION_AXES];
+static int32_t first[MOTION_AXES]; // position before the program
+static uint32_t errors;            // lines answered with an error
+
+// the same settings as the simulated serial port to start with
+static void default_settings() {
+    steps_per_rev = 200;
+    micro_steps = 4;
+    degrees_per_rev = 5;
+    degrees_per_sec = 20;
+    degrees_accel = 20;
+    axis_config[1].steps_per_rev = 200;
+    axis_config[1].micro_steps = 4;
+    axis_config[1].degrees_per_rev = 5;
+}
+
+// read the "name value" lines of a settings file
+// returns false if a line is not a setting or a value is out of range
+static bool read_settings(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        perror(path);
+        return false;
+    }
+    char line[128];
+    int number = 0;
+    bool ok = true;
+    while (fgets(line, sizeof(line), file)) {
+        number++;
+        char *comment = strchr(line, '#');
+        if (comment) {
+            *comment = 0;
+        }
+        char name[64];
+        double value;
+        int fields = sscanf(line, " %63s %lf", name, &value);
+        if (fields <= 0) {
+            continue; // blank
+        }
+        const setting_t *setting = NULL;
+        for (const setting_t &s : settings_list) {
+            if (fields == 2 && strcmp(s.name, name) == 0) {
+                setting = &s;
+            }
+        }
+        if (!setting) {
+            fprintf(stderr, "%s:%d: not a setting and value\n", path,
+                    number);
+            ok = false;
+        } else if (setting->integer) {
+            *setting->integer = std::lround(value);
+        } else {
+            *setting->real = value;
+        }
+    }
+    fclose(file);
+    const axis_config_t &tilt = axis_config[1];
+    if (steps_per_rev <= 0 || micro_steps <= 0 || !(degrees_per_rev > 0) ||
+        tilt.steps_per_rev <= 0 || tilt.micro_steps <= 0 ||
+        !(tilt.degrees_per_rev > 0)) {
+        fprintf(stderr, "%s: steps and degrees must be more than 0\n", path);
+        return false;
+    }
+    if (degrees_per_sec <= 0 || degrees_accel <= 0 || degrees_jerk < 0) {
+        fprintf(stderr, "%s: rates must be more than 0\n", path);
+        return false;
+    }
+    return ok;
+}
+
+// replies other than ok are shown, errors are counted
+static void reply(const char *text) {
+    if (strcmp(text, "ok\n") == 0) {
+        return;
+    }
+    if (strncmp(text, "error", 5) == 0) {
+        errors++;
+        fputs(text, stderr);
+    } else {
+        fputs(text, stdout);
+    }
+}
+
+// note the axes that have started from rest
+static void note_starts() {
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        stepper_t *stepper = steppers[axis];
+        bool running = stepper->isRunning();
+        if (running && !was_running[axis]) {
+            starts[axis].push_back(
+                {stepper->now(), stepper->getCurrentPosition()});
+        }
+        was_running[axis] = running;
+    }
+}
+
+// feed the program to the serial protocol like the serial task, as there
+// is room for each line, and run the motion task every millisecond of
+// simulated time like the ESP32 does, until the program is done
+// returns false if it runs past the time limit
+static bool run_program(FILE *file) {
+    int next = -1;      // character read but not yet taken
+    bool ended = false; // the whole file has been read
+    uint64_t now = 0;
+    for (;;) {
+        for (;;) {
+            if (next < 0) {
+                if (ended) {
+                    break;
+                }
+                next = fgetc(file);
+                if (next == EOF) {
+                    next = '\n'; // end a last line with no line ending
+                    ended = true;
+                }
+            }
+            if (!serial_ready() && next != '!' && next != '?') {
+                break;
+            }
+            serial_input(next);
+            next = -1;
+        }
+        bool waiting = serial_service();
+        motion_service();
+        note_starts();
+        motion_status_t status;
+        motion_get_status(&status);
+        if (ended && next < 0 && !waiting && !status.running &&
+            motion_program_idle(status)) {
+            return true;
+        }
+        if (now >= (uint64_t)PROFILE_RUN_LIMIT * TICKS_PER_S) {
+            fprintf(stderr, "still running after %d s\n", PROFILE_RUN_LIMIT);
+            return false;
+        }
+        now += TICKS_PER_S / 1000;
+        for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+            steppers[axis]->advance(now - steppers[axis]->now());
+        }
+        note_starts();
+        motion_service();
+        note_starts();
+        set_current_position();
+    }
+}
+
+static double seconds(uint64_t ticks) { return (double)ticks / TICKS_PER_S; }
+
+// exact degrees of a step of an axis
+static double degrees_per_step(uint8_t axis) {
+    const axis_config_t &config = axis_config[axis];
+    return (double)config.degrees_per_rev / config.steps_per_rev /
+           config.micro_steps;
+}
+
+// every step of each axis with its time in seconds
+static bool write_steps(const char *path) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        perror(path);
+        return false;
+    }
+    fprintf(file, "axis,time,position\n");
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        for (const sim_step_t &step : steppers[axis]->trace) {
+            fprintf(file, "%c,%.9f,%d\n", 'A' + axis, seconds(step.ticks),
+                    (int)step.position);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+// the starts from rest and the steps of an axis in time order, from where
+// it was before the program
+static std::vector<point_t> axis_points(uint8_t axis) {
+    std::vector<point_t> points = {{0, first[axis]}};
+    size_t start = 0;
+    for (const sim_step_t &step : steppers[axis]->trace) {
+        while (start < starts[axis].size() &&
+               starts[axis][start].ticks < step.ticks) {
+            points.push_back(starts[axis][start++]);
+        }
+        points.push_back({step.ticks, step.position});
+    }
+    while (start < starts[axis].size()) {
+        points.push_back(starts[axis][start++]);
+    }
+    return points;
+}
+
+// step position at a time, moving evenly from one point to the next,
+// index is the point at or before the last time asked for
+static double position_at(const std::vector<point_t> &points, double ticks,
+                          size_t *index) {
+    size_t &i = *index;
+    while (i + 1 < points.size() && points[i + 1].ticks <= ticks) {
+        i++;
+    }
+    if (i + 1 == points.size() || ticks <= points[i].ticks) {
+        return points[i].position;
+    }
+    const point_t &a = points[i];
+    const point_t &b = points[i + 1];
+    return a.position + (double)(b.position - a.position) *
+                            (ticks - a.ticks) / (b.ticks - a.ticks);
+}
+
+// the position, velocity, acceleration and jerk of each axis in degrees
+// at each interval of seconds, as differences over the interval before
+static bool write_trace(const char *path, double interval, uint64_t end) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        perror(path);
+        return false;
+    }
+    fprintf(file, "time");
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        char name = 'a' + axis;
+        fprintf(file, ",%c_position,%c_velocity,%c_acceleration,%c_jerk",
+                name, name, name, name);
+    }
+    fprintf(file, "\n");
+    std::vector<point_t> points[MOTION_AXES];
+    size_t index[MOTION_AXES] = {};
+    double last[MOTION_AXES][3] = {}; // position, velocity, acceleration
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        points[axis] = axis_points(axis);
+        last[axis][0] = first[axis] * degrees_per_step(axis);
+    }
+    uint64_t samples = std::ceil(seconds(end) / interval) + 1;
+    for (uint64_t k = 0; k <= samples; k++) {
+        double time = k * interval;
+        fprintf(file, "%.6f", time);
+        for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+            double position =
+                degrees_per_step(axis) *
+                position_at(points[axis], time * TICKS_PER_S, &index[axis]);
+            double velocity = k ? (position - last[axis][0]) / interval : 0;
+            double acceleration =
+                k > 1 ? (velocity - last[axis][1]) / interval : 0;
+            double jerk = k > 2 ? (acceleration - last[axis][2]) / interval
+                                : 0;
+            fprintf(file, ",%.6f,%.4f,%.3f,%.1f", position, velocity,
+                    acceleration, jerk);
+            last[axis][0] = position;
+            last[axis][1] = velocity;
+            last[axis][2] = acceleration;
+        }
+        fprintf(file, "\n");
+    }
+    fclose(file);
+    return true;
+}
+
+// the mean velocity of a run of steps, at the middle of its time
+struct mean_t {
+    double time;     // seconds
+    double velocity; // degrees per second
+};
+
+// a spike is a jerk of more than twice the limit, or with no limit a
+// change of more than half the acceleration over the interval
+static bool spike(double jerk, double interval) {
+    if (degrees_jerk > 0) {
+        return std::fabs(jerk) > 2.0 * degrees_jerk;
+    }
+    return std::fabs(jerk) * interval > degrees_accel / 2.0;
+}
+
+// add the peaks of a move from its steps, the velocity of each step is
+// from the step before, the acceleration is the change from one mean
+// velocity to the next of runs of at least PROFILE_PEAK_STEPS steps lasting
+// at least PROFILE_PEAK_TIME, and the jerk the change of that over at least
+// PROFILE_JERK_TIME, as the mean velocity of a steady ramp is its velocity
+// at the middle of the run a ramp gives its acceleration exactly, whatever
+// the trace interval
+//
+// a jerk limited move is fed to the stepper as queue entries of a steady
+// step rate, so its velocity goes up in small stairs some milliseconds
+// apart, the runs are long enough to span a few of them, and the jerk is
+// taken over a few runs, or the stairs show as acceleration and jerk
+static void move_peaks(const sim_step_t *steps, size_t count, double step,
+                       peaks_t *peak) {
+    std::vector<mean_t> means;
+    size_t run = 0; // first step of the run
+    for (size_t i = 1; i < count; i++) {
+        double time = seconds(steps[i].ticks - steps[i - 1].ticks);
+        double velocity = (steps[i].position - steps[i - 1].position) * step;
+        peak->velocity = std::max(peak->velocity, std::fabs(velocity / time));
+        double span = seconds(steps[i].ticks - steps[run].ticks);
+        if (i - run >= PROFILE_PEAK_STEPS && span >= PROFILE_PEAK_TIME) {
+            means.push_back(
+                {seconds(steps[i].ticks + steps[run].ticks) / 2,
+                 (steps[i].position - steps[run].position) * step / span});
+            run = i;
+        }
+    }
+    // the acceleration between each mean and the one before, as a mean
+    std::vector<mean_t> accelerations;
+    for (size_t i = 1; i < means.size(); i++) {
+        double acceleration = (means[i].velocity - means[i - 1].velocity) /
+                              (means[i].time - means[i - 1].time);
+        accelerations.push_back(
+            {(means[i].time + means[i - 1].time) / 2, acceleration});
+        peak->acceleration =
+            std::max(peak->acceleration, std::fabs(acceleration));
+    }
+    bool over = false;
+    size_t back = 0; // acceleration the jerk is taken from
+    for (size_t i = 1; i < accelerations.size(); i++) {
+        while (accelerations[i].time - accelerations[back + 1].time >=
+               PROFILE_JERK_TIME) {
+            back++;
+        }
+        double interval = accelerations[i].time - accelerations[back].time;
+        if (interval < PROFILE_JERK_TIME) {
+            continue;
+        }
+        double jerk =
+            (accelerations[i].velocity - accelerations[back].velocity) /
+            interval;
+        peak->jerk = std::max(peak->jerk, std::fabs(jerk));
+        bool now_over = spike(jerk, interval);
+        if (now_over && !over) {
+            peak->spikes++;
+        }
+        over = now_over;
+    }
+}
+
+// the peaks of the moves of an axis, each start from rest begins a move
+static peaks_t axis_peaks(uint8_t axis) {
+    const std::vector<sim_step_t> &trace = steppers[axis]->trace;
+    peaks_t peak = {0, 0, 0, 0};
+    size_t step = 0;
+    for (size_t i = 0; i < starts[axis].size(); i++) {
+        uint64_t next = i + 1 < starts[axis].size() ? starts[axis][i + 1].ticks
+                                                    : UINT64_MAX;
+        size_t begin = step;
+        while (step < trace.size() && trace[step].ticks < next) {
+            step++;
+        }
+        move_peaks(trace.data() + begin, step - begin,
+                   degrees_per_step(axis), &peak);
+    }
+    return peak;
+}
+
+// each move of an axis with its time and peak step rate, then the peaks
+// of its trace
+static void print_summary(uint8_t axis, uint64_t end, const peaks_t &peak) {
+    const std::vector<sim_step_t> &trace = steppers[axis]->trace;
+    char name = 'A' + axis;
+    if (trace.empty()) {
+        printf("%c: no moves\n", name);
+        return;
+    }
+    uint64_t moving = 0;
+    size_t step = 0;
+    for (size_t i = 0; i < starts[axis].size(); i++) {
+        const point_t &start = starts[axis][i];
+        uint64_t next = i + 1 < starts[axis].size() ? starts[axis][i + 1].ticks
+                                                    : UINT64_MAX;
+        uint64_t last = start.ticks;
+        int32_t position = start.position;
+        double peak_rate = 0;
+        size_t count = 0;
+        for (; step < trace.size() && trace[step].ticks < next; step++) {
+            double rate = (double)TICKS_PER_S / (trace[step].ticks - last);
+            peak_rate = std::max(peak_rate, rate);
+            last = trace[step].ticks;
+            position = trace[step].position;
+            count++;
+        }
+        if (count == 0) {
+            continue;
+        }
+        moving += last - start.ticks;
+        printf("%c: %.3f to %.3f s, %d steps in %.3f s, peak %.0f "
+               "steps/s\n",
+               name, seconds(start.ticks), seconds(last),
+               (int)(position - start.position), seconds(last - start.ticks),
+               peak_rate);
+    }
+    printf("%c: %zu steps, moving %.3f s of %.3f s\n", name, trace.size(),
+           seconds(moving), seconds(end));
+    printf("%c: peak %.2f deg/s, %.2f deg/s^2, %.0f deg/s^3, %u jerk "
+           "spikes\n",
+           name, peak.velocity, peak.acceleration, peak.jerk, peak.spikes);
+}
+
+// run a G-code program with the settings from a file, NULL for the
+// defaults, and write prefix-steps.csv and prefix-trace.csv with a trace
+// interval in mS
+// returns the exit code, 0 if it ran, 1 if a line was refused or it ran
+// too long and 2 if a file could not be read or written
+int profile_run(const char *program, const char *settings,
+                const char *prefix, double interval) {
+    default_settings();
+    if (settings && !read_settings(settings)) {
+        return 2;
+    }
+    if (!(interval > 0)) {
+        fprintf(stderr, "the trace interval must be more than 0\n");
+        return 2;
+    }
+    FILE *file = strcmp(program, "-") == 0 ? stdin : fopen(program, "r");
+    if (!file) {
+        perror(program);
+        return 2;
+    }
+    set_angle_per_step();
+    set_step_rate();
+    set_acceleration();
+    set_jerk();
+    set_backlash();
+    pitch_update();
+    motion_service();
+    serial_set_writer(reply);
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        steppers[axis]->record = true;
+        steppers[axis]->trace.clear();
+        first[axis] = steppers[axis]->getCurrentPosition();
+    }
+    bool done = run_program(file);
+    if (file != stdin) {
+        fclose(file);
+    }
+    // the end of the last step of either axis
+    uint64_t end = 0;
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        if (!steppers[axis]->trace.empty()) {
+            end = std::max(end, steppers[axis]->trace.back().ticks);
+        }
+    }
+    std::string name = prefix;
+    if (!write_steps((name + "-steps.csv").c_str()) ||
+        !write_trace((name + "-trace.csv").c_str(), interval / 1000, end)) {
+        return 2;
+    }
+    printf("A: %d steps/rev x %d, %g deg/rev, B: %d steps/rev x %d, %g "
+           "deg/rev\n",
+           (int)steps_per_rev, (int)micro_steps, degrees_per_rev,
+           (int)axis_config[1].steps_per_rev,
+           (int)axis_config[1].micro_steps, axis_config[1].degrees_per_rev);
+    printf("%d deg/s, %d deg/s^2, jerk %d deg/s^3, trace every %g mS\n",
+           (int)degrees_per_sec, (int)degrees_accel, (int)degrees_jerk,
+           interval);
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        print_summary(axis, end, axis_peaks(axis));
+    }
+    return done && errors == 0 ? 0 : 1;
+}
+
+// a move of the table at the default settings with a jerk, or none, the
+// simulated steppers are left stopped with the trace cleared
+// returns false if the move failed
+static bool check_move(int32_t jerk, peaks_t *peak) {
+    default_settings();
+    degrees_jerk = jerk;
+    backlash_steps = 0;
+    approach_direction = 0;
+    set_angle_per_step();
+    set_step_rate();
+    set_acceleration();
+    set_jerk();
+    set_backlash();
+    motion_service();
+    serial_set_writer(reply);
+    errors = 0;
+    bool record[MOTION_AXES];
+    bool timed[MOTION_AXES];
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        stepper_t *stepper = steppers[axis];
+        record[axis] = stepper->record;
+        timed[axis] = stepper->timed;
+        stepper->record = true;
+        stepper->timed = false;
+        stepper->trace.clear();
+        starts[axis].clear();
+        first[axis] = stepper->getCurrentPosition();
+    }
+    char move[] = "G91 G0 A90\nG90\n";
+    FILE *file = fmemopen(move, strlen(move), "r");
+    bool done = file && run_program(file);
+    if (file) {
+        fclose(file);
+    }
+    *peak = axis_peaks(0);
+    for (uint8_t axis = 0; axis < MOTION_AXES; axis++) {
+        stepper_t *stepper = steppers[axis];
+        stepper->record = record[axis];
+        stepper->timed = timed[axis];
+        stepper->trace.clear();
+    }
+    serial_set_writer(NULL);
+    return done && errors == 0;
+}
+
+// a move of the table at the default settings with no jerk limit, then
+// one with PROFILE_CHECK_JERK
+// returns false unless the peaks of the first are the set speed and
+// acceleration, to within 1%, and those of the second are no more than
+// them without a jerk spike, the jerk is at most a quarter over its limit
+// and the acceleration within 5% under as the move reaches it
+bool profile_check(peaks_t *plain, peaks_t *jerked) {
+    bool pass = check_move(0, plain) &&
+                std::fabs(plain->velocity / degrees_per_sec - 1) <= 0.01 &&
+                std::fabs(plain->acceleration / degrees_accel - 1) <= 0.01;
+    pass = check_move(PROFILE_CHECK_JERK, jerked) && pass &&
+           jerked->velocity <= degrees_per_sec * 1.01 &&
+           jerked->acceleration <= degrees_accel &&
+           jerked->acceleration >= degrees_accel * 0.95 &&
+           jerked->jerk <= degrees_jerk * 1.25 && jerked->spikes == 0;
+    degrees_jerk = 0;
+    set_jerk();
+    motion_service();
+    return pass;
+}
@@ -0,0 +1,63 @@
+// Rotary Table profile run
+//
+// runs a G-code program through the serial protocol and the motion logic
+// against the simulated steppers in simulated time, as fast as it can go,
+// with the drive settings read from a file, so speed, acceleration and
+// jerk settings can be tried and swept without the machine
+//
+// it writes every step of each axis with its time, and a trace of the
+// position, velocity, acceleration and jerk of each axis in degrees at a
+// fixed interval, as CSV files, and prints each move with its time and
+// peak step rate and the peaks and jerk spikes of each axis
+//
+// the position between steps is taken to move evenly from one step to
+// the next, from when the axis starts from rest, and the trace is the
+// differences of it over each interval
+//
+// the peaks are worked out from the step times, not the trace, so they
+// don't change with the interval, the velocity from each step and the
+// acceleration and jerk from the mean velocities of runs of steps long
+// enough to smooth the small stairs a jerk limited move climbs in, so the
+// jerk of a plain FastAccelStepper ramp shows as a spike at each end of
+// each ramp
+//
+// the settings file has a "name value" line for each setting that isn't
+// the default, with # comments
+//
+//   steps_per_rev 200        motor steps per motor revolution
+//   micro_steps 4            driver microstep setting
+//   degrees_per_rev 5        table degrees per motor revolution
+//   degrees_per_sec 20       velocity in degrees per second
+//   degrees_accel 20         acceleration in degrees per sec ^2
+//   degrees_jerk 0           jerk in degrees per sec ^3, 0 off
+//   backlash_steps 0         steps of backlash in the table drive
+//   approach_direction 0     end table moves this way, 0 for either
+//   tilt_steps_per_rev 200   the same for the tilt axis
+//   tilt_micro_steps 4
+//   tilt_degrees_per_rev 5
+
+#ifndef PROFILE_RUN_H
+#define PROFILE_RUN_H
+
+#include <stdint.h>
+
+#define PROFILE_RUN_INTERVAL 1.0 // default trace interval in mS
+#define PROFILE_RUN_LIMIT 3600   // longest program in simulated seconds
+#define PROFILE_PEAK_STEPS 8     // fewest steps in a mean velocity
+#define PROFILE_PEAK_TIME 0.05   // shortest mean velocity in seconds
+#define PROFILE_JERK_TIME 0.15   // shortest jerk interval in seconds
+#define PROFILE_CHECK_JERK 20    // jerk of the checked jerk limited move
+
+// the peaks of an axis over its moves
+struct peaks_t {
+    double velocity;     // degrees per second
+    double acceleration; // degrees per second^2
+    double jerk;         // degrees per second^3
+    uint32_t spikes;     // times the jerk went over the limit
+};
+
+int profile_run(const char *program, const char *settings,
+                const char *prefix, double interval);
+bool profile_check(peaks_t *plain, peaks_t *jerked);
+
+#endif
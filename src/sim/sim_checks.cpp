@@ -0,0 +1,1240 @@
+// Rotary Table simulator checks
+
+#include "sim_checks.h"
+#include "../encoder.h"
+#include "../estop.h"
+#include "../gearing.h"
+#include "../home.h"
+#include "../motion.h"
+#include "../pitch.h"
+#include "../program.h"
+#include "../serial.h"
+#include "../step_trace.h"
+#include "../tune.h"
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+
+// degrees per motor rev that give a whole number of steps per circle
+static const float degrees_per_rev_list[] = {1,  2,  3,  4,  5,  6,  8,
+                                             9,  10, 12, 15, 18, 20, 24,
+                                             30, 36, 40, 45, 60, 72, 90};
+static const int32_t micro_steps_list[] = {1, 2, 4, 8, 16, 32, 64, 128, 256};
+
+sim_stats_t sim_stats;
+
+static SimStepper sim;  // table axis
+static SimStepper tilt; // tilt axis
+static std::mt19937 rng;
+static uint32_t seed;           // seed of the run
+static uint32_t round_number;   // round being run
+static double tolerance;        // allowed position error in steps
+static double steps_per_degree; // exact steps per degree
+static int32_t table;           // table position, behind the backlash
+static int32_t flag_start;      // table position the home flag starts at
+static int32_t flag_width;      // steps of the home flag
+static bool flag_in;            // the table is at the home flag
+static int32_t flag_edge;       // table position of the last flag edge
+static int32_t motor;           // motor step position, behind lost steps
+static int32_t slip_left;       // steps the motor is still to lose
+static double slip_chance;      // chance of a slip at each step
+static uint64_t slips;          // slips so far
+static int32_t stop_at;         // steps to the emergency stop
+static int32_t stop_edge;       // step position at the emergency stop
+static double limit_speed;      // fastest the motor turns in steps/s
+static double limit_accel;      // fastest it speeds up in steps/s^2
+static double last_speed;       // step rate at the last step
+static bool stalled;            // the motor loses steps until it stops
+
+// a check failed, the first few are printed with the seed and round and
+// the first is kept for the unit tests
+static void fail(const char *check, const char *format, ...) {
+    char text[SIM_FAILURE_SIZE];
+    int length = snprintf(text, sizeof(text), "%s, seed %u round %u: ",
+                          check, (unsigned)seed, (unsigned)round_number);
+    if (length > 0 && length < (int)sizeof(text)) {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(text + length, sizeof(text) - length, format, args);
+        va_end(args);
+    }
+    if (!sim_stats.failures) {
+        strcpy(sim_stats.failure, text);
+    }
+    if (sim_stats.failures++ < SIM_SHOWN_FAILURES) {
+        fprintf(stderr, "FAIL %s\n", text);
+    }
+}
+
+// random float in a range
+static float random_float(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(rng);
+}
+
+// random int in a range
+static int32_t random_int(int32_t min, int32_t max) {
+    return std::uniform_int_distribution<int32_t>(min, max)(rng);
+}
+
+// pick random drive settings
+static void random_settings() {
+    steps_per_rev = 200;
+    micro_steps = micro_steps_list[random_int(0, 8)];
+    degrees_per_rev = degrees_per_rev_list[random_int(0, 20)];
+    degrees_per_sec = random_int(1, 100);
+    degrees_accel = random_int(1, 1000);
+    // half the time with a jerk limit
+    degrees_jerk = random_int(0, 1) ? random_int(1, 100000) : 0;
+    backlash_steps = random_int(0, 1) ? random_int(1, 20) : 0;
+    approach_direction = random_int(-1, 1);
+    axis_config[1].steps_per_rev = 200;
+    axis_config[1].micro_steps = micro_steps_list[random_int(0, 8)];
+    axis_config[1].degrees_per_rev = degrees_per_rev_list[random_int(0, 20)];
+    // a once around error and a bit of noise at each point
+    bool pitch = random_int(0, 1);
+    float amplitude = random_float(0, PITCH_MAX_ERROR / 2);
+    float phase = random_float(0, 2 * M_PI);
+    for (int i = 0; i < PITCH_POINTS; i++) {
+        float angle = 2 * M_PI * i / PITCH_POINTS + phase;
+        float error = amplitude * std::sin(angle) + random_float(-10, 10);
+        pitch_map[i] = pitch ? std::lround(error) : 0;
+    }
+    pitch_update();
+    set_angle_per_step();
+    set_step_rate();
+    set_acceleration();
+    set_jerk();
+    set_backlash();
+    steps_per_degree = (double)steps_per_rev * micro_steps / degrees_per_rev;
+}
+
+// start a run, with a position error allowed of tolerance steps
+void sim_begin(uint32_t run_seed, double allowed) {
+    seed = run_seed;
+    tolerance = allowed;
+    sim_stats = {};
+    steppers[0] = &sim;
+    steppers[1] = &tilt;
+    // like the ESP32 trace build only the table steps are timed
+    tilt.timed = false;
+}
+
+// random settings and a random table position for a round
+void sim_round(uint32_t round) {
+    round_number = round;
+    std::seed_seq seeds{seed, round};
+    rng.seed(seeds);
+    random_settings();
+    table = random_int(-1000000, 1000000);
+    motion_post(MOTION_SET_POSITION, table);
+    motion_service();
+    set_current_position();
+    sim.trace.clear();
+    tilt.trace.clear();
+}
+
+// the table only follows the stepper once the backlash is taken up
+static void move_table() {
+    if (sim.cut) {
+        return; // the steps don't reach the motor
+    }
+    int32_t position = sim.getCurrentPosition();
+    if (table > position) {
+        table = position;
+    } else if (table < position - backlash_steps) {
+        table = position - backlash_steps;
+    }
+}
+
+// where the table really is at a step position, in steps with the pitch
+// error
+static double table_position(int32_t steps = table) {
+    angle_t motor = steps_to_angle(steps);
+    int32_t error = pitch_to_table(motor) - motor;
+    return steps + (double)error * circle_steps / ANGLE_TURN;
+}
+
+// compare the time since begin with an estimated time, as a fraction of
+// the estimate, moves of a few steps are left out as their ramps are too
+// short to follow the closed form times
+static void check_time(uint64_t begin, double estimate) {
+    double time = (double)(sim.now() - begin) / TICKS_PER_S;
+    // the estimates leave out backlash and approach moves
+    if (estimate > 0.1 && backlash_steps == 0) {
+        double error = std::abs(time - estimate) / estimate;
+        if (error > sim_stats.max_time_error) {
+            sim_stats.max_time_error = error;
+        }
+    }
+}
+
+// finish the move then update the position like the gui loop does, a
+// jerk limited move is queued to the stepper a part at a time
+static void finish_move() {
+    int32_t start = table;
+    uint64_t begin = sim.now();
+    motion_status_t status;
+    do {
+        motion_service();
+        sim.run_until_idle();
+        move_table();
+        motion_service();
+        motion_get_status(&status);
+    } while (status.running);
+    set_current_position();
+    check_time(begin, motion_time(table - start));
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim_stats.moves++;
+}
+
+// compare the stepper position with the exact position of an angle, the
+// planner rounds the motor angle for the table angle to a step so the
+// error is in motor steps, a step that crosses a pitch map point is not
+// the same length on each side of it, check names the move
+static void check_position(const char *check, double angle) {
+    double circle = 360 * steps_per_degree;
+    double turn = angle / 360 - std::floor(angle / 360);
+    angle_t table_angle = (angle_t)std::llround(turn * ANGLE_TURN);
+    double motor = angle * steps_per_degree +
+                   (double)pitch_offset(table_angle) * circle_steps /
+                       ANGLE_TURN;
+    double error = std::fmod(table - motor, circle);
+    if (error > circle / 2) {
+        error -= circle;
+    } else if (error < -circle / 2) {
+        error += circle;
+    }
+    // allow for the resolution of the position and target angles
+    error = std::abs(error) - 2.0 * circle_steps / ANGLE_TURN;
+    if (error > sim_stats.max_error) {
+        sim_stats.max_error = error;
+    }
+    // allow for the double rounding of the exact position
+    if (error > tolerance + 1e-6) {
+        fail(check, "%.3f steps off %.4f deg at step %d, tolerance %.3f",
+             error, angle, (int)table, tolerance);
+    }
+}
+
+// go to the division start then step through every division and back,
+// the divisions forward are queued as it moves half the time
+void sim_divisions() {
+    division_steps = random_int(1, 999);
+    division_start = degrees_to_angle(random_float(0, 360));
+    if (random_int(0, 3) == 0) {
+        // full circle
+        division_end = division_start;
+    } else {
+        division_end = degrees_to_angle(random_float(0, 360));
+    }
+    division_direction = random_int(0, 1) ? 1 : -1;
+    set_division_angle();
+    double angle = division_angle * 360.0 / ANGLE_TURN;
+    motion_absolute_move(2 * division_direction);
+    finish_move();
+    check_position("division start", division_start * 360.0 / ANGLE_TURN);
+    // divisions are measured from where the division start move stopped
+    double start = table_position() / steps_per_degree;
+    // half the time the next divisions are touched while it moves, they
+    // are queued behind it and anything else is rejected
+    bool queue = random_int(0, 1);
+    for (int32_t i = 1; i <= division_steps; i++) {
+        motion_goto_division(1);
+        motion_service();
+        if (queue) {
+            motion_status_t status;
+            motion_get_status(&status);
+            if (status.running && motion_input(INPUT_OTHER) != INPUT_REJECTED) {
+                fail("division queue", "other input taken at division %d",
+                     (int)i);
+            }
+            while (i < division_steps && motion_goto_division(1)) {
+                motion_service();
+                i++;
+                sim_stats.moves++;
+            }
+            do {
+                motion_service();
+                sim.run_until_idle();
+                move_table();
+                motion_service();
+                motion_get_status(&status);
+            } while (status.running);
+            set_current_position();
+#if STEP_TRACE
+            step_trace_end(NULL);
+#endif
+            sim_stats.moves++;
+        } else {
+            finish_move();
+        }
+        check_position("division", start + angle * i / division_steps);
+    }
+    for (int32_t i = division_steps - 1; i >= 0; i--) {
+        motion_goto_division(-1);
+        finish_move();
+        check_position("division", start + angle * i / division_steps);
+    }
+}
+
+// run the division cycle as a motion program with a random dwell, feeding
+// it from the position updates like the gui loop does
+void sim_division_program() {
+    double angle = division_angle * 360.0 / ANGLE_TURN;
+    division_dwell = random_int(0, 3);
+    motion_absolute_move(2 * division_direction);
+    finish_move();
+    double start = table_position() / steps_per_degree;
+    double estimate = division_cycle_time();
+    uint64_t begin = sim.now();
+    if (!motion_run_divisions()) {
+        return;
+    }
+    while (motion_program_running()) {
+        motion_service();
+        if (sim.isRunning()) {
+            sim.run_until_idle();
+        } else {
+            sim.advance(TICKS_PER_S / 1000);
+        }
+        move_table();
+        set_current_position();
+    }
+    sim_stats.moves += division_steps;
+    check_time(begin, estimate);
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    if (current_division != division_steps) {
+        fail("division cycle", "ended on division %d of %d",
+             (int)current_division, (int)division_steps);
+    }
+    check_position("division cycle", start + angle);
+}
+
+// save a random angle list to a slot and load it, go to its first angle
+// then step through every angle and back, then run it as a division
+// program
+void sim_program() {
+    int32_t direction = random_int(-1, 1);
+    program_begin(direction, "sim");
+    int32_t count = random_int(2, 50);
+    for (int32_t i = 0; i < count; i++) {
+        program_append(degrees_to_angle(random_float(0, 360)));
+    }
+    int32_t slot = random_int(1, PROGRAM_SLOTS);
+    if (!program_save(slot) || !program_load(slot)) {
+        fail("program save", "%d angles not saved to slot %d", (int)count,
+             (int)slot);
+        return;
+    }
+    // exact degrees of each angle from the first
+    const program_t &program = loaded_program;
+    double angles[PROGRAM_MAX_ANGLES];
+    int64_t angle = 0;
+    angles[0] = 0;
+    for (int32_t i = 1; i < program.count; i++) {
+        angle += program_move(program.angles[i - 1], program.angles[i],
+                              program.direction);
+        angles[i] = angle * 360.0 / ANGLE_TURN;
+    }
+    int32_t last = program.count - 1;
+    division_dwell = random_int(0, 3);
+    for (int32_t run = 0; run < 2; run++) {
+        motion_absolute_move(2);
+        finish_move();
+        check_position("program start", program.angles[0] * 360.0 / ANGLE_TURN);
+        double start = table_position() / steps_per_degree;
+        if (run == 0) {
+            for (int32_t i = 1; i <= last; i++) {
+                motion_goto_division(1);
+                finish_move();
+                check_position("program angle", start + angles[i]);
+            }
+            for (int32_t i = last - 1; i >= 0; i--) {
+                motion_goto_division(-1);
+                finish_move();
+                check_position("program angle", start + angles[i]);
+            }
+            continue;
+        }
+        double estimate = division_cycle_time();
+        uint64_t begin = sim.now();
+        if (!motion_run_divisions()) {
+            fail("program cycle", "not started");
+            break;
+        }
+        while (motion_program_running()) {
+            motion_service();
+            if (sim.isRunning()) {
+                sim.run_until_idle();
+            } else {
+                sim.advance(TICKS_PER_S / 1000);
+            }
+            move_table();
+            set_current_position();
+        }
+        sim_stats.moves += last;
+        check_time(begin, estimate);
+#if STEP_TRACE
+        step_trace_end(NULL);
+#endif
+        if (current_division != last) {
+            fail("program cycle", "ended on angle %d of %d",
+                 (int)current_division, (int)last);
+        }
+        check_position("program cycle", start + angles[last]);
+    }
+    program_unload();
+}
+
+// a few milling runs of whole turns, or that run on and are ended after a
+// second, changing the feed override every so often while they move
+void sim_milling() {
+    for (int run = 0; run < 3; run++) {
+        int32_t dir = random_int(0, 1) ? 1 : -1;
+        mill_turns = random_int(0, 1);
+        mill_end = degrees_to_angle(random_float(0, 360));
+        feed_override = 100;
+        motion_mill(dir);
+        motion_service();
+        bool ended = mill_turns != 0;
+        int32_t last = sim.getCurrentPosition();
+        motion_status_t status;
+        for (int32_t i = 1;; i++) {
+            sim.advance(TICKS_PER_S / 20);
+            move_table();
+            int32_t position = sim.getCurrentPosition();
+            if ((int64_t)(position - last) * dir < 0) {
+                fail("milling", "turned back from step %d to %d", (int)last,
+                     (int)position);
+            }
+            last = position;
+            if (random_int(0, 3) == 0) {
+                feed_override = random_int(MIN_OVERRIDE, MAX_OVERRIDE);
+                set_feed_override();
+            }
+            if (!ended && i == 20) {
+                ended = motion_mill_end();
+            }
+            motion_service();
+            motion_get_status(&status);
+            if (!status.running) {
+                break;
+            }
+        }
+        set_current_position();
+        check_position("milling end", mill_end * 360.0 / ANGLE_TURN);
+#if STEP_TRACE
+        step_trace_end(NULL);
+#endif
+        // a run can be a lot of steps to keep
+        sim.trace.clear();
+        sim_stats.moves++;
+    }
+}
+
+// follow an encoder that moves in random runs of a speed, within half the
+// speed and acceleration of the table, then stops, a millisecond at a time
+// like the motion task polls it, the stop takes as long as it needs so the
+// table can stop on the target without going past it
+void sim_gearing() {
+    // no more than 100 steps a count, the table can't follow a count that
+    // is a big jump at once
+    int32_t fewest = std::max<int32_t>(100, circle_steps / 100);
+    fewest = std::min<int32_t>(fewest, MAX_GEAR_COUNTS);
+    gear_counts = random_int(fewest, MAX_GEAR_COUNTS) *
+                  (random_int(0, 1) ? 1 : -1);
+    double steps_per_count = (double)circle_steps / gear_counts;
+    double ratio = std::abs(steps_per_count);
+    // within what a slice can step too
+    double step_rate = std::min<double>(
+        degrees_per_sec * steps_per_degree,
+        (double)GEAR_MAX_STEPS * TICKS_PER_S / GEAR_SLICE_TICKS);
+    double speed = 0.5 * step_rate / ratio;
+    double accel = 0.5 * degrees_accel * steps_per_degree / ratio;
+    // the table lags the encoder by the slices queued ahead, those the
+    // smoothed encoder speed takes to see a change and those the lag is
+    // closed in, at the fastest speed, two counts of the ratio as a coarse
+    // encoder jumps a count at a time and the next comes before the last
+    // is closed at a slow acceleration, the rounding of the steps either way
+    // and the backlash taken up at a reversal
+    double slices = (double)(GEAR_AHEAD_TICKS + GEAR_SLICE_TICKS) /
+                        GEAR_SLICE_TICKS +
+                    GEAR_FILTER + GEAR_CATCH_SLICES;
+    double bound = speed * ratio * slices * GEAR_SLICE_TICKS / TICKS_PER_S +
+                   2 * ratio + 2 + 2 * backlash_steps;
+    motion_status_t status;
+    motion_get_status(&status);
+    int32_t start = status.position[0];
+    motion_gear(true);
+    motion_service();
+    double encoder = 0;  // exact encoder position in counts
+    double velocity = 0; // counts per second
+    int64_t counts = 0;  // whole counts fed
+    double worst = 0;    // largest lag in steps
+    const double tick = 0.001;
+    for (int run = 0; run < 4; run++) {
+        // the last run is a stop
+        double want = run == 3 ? 0 : random_float(-speed, speed);
+        int32_t hold = random_int(0, 300);
+        for (int32_t ms = 0;
+             (run == 3 || ms < 5000) && (velocity != want || hold--); ms++) {
+            if (velocity < want) {
+                velocity = std::min(want, velocity + accel * tick);
+            } else if (velocity > want) {
+                velocity = std::max(want, velocity - accel * tick);
+            }
+            encoder += velocity * tick;
+            int64_t whole = std::floor(encoder);
+            encoder_feed(whole - counts);
+            counts = whole;
+            motion_service();
+            sim.advance(TICKS_PER_S / 1000);
+            move_table();
+            motion_get_status(&status);
+            double lag = std::abs(status.position[0] - start -
+                                  counts * steps_per_count);
+            worst = std::max(worst, lag);
+        }
+    }
+    sim_stats.max_gear_lag = std::max(sim_stats.max_gear_lag, worst);
+    sim_stats.max_lag_share = std::max(sim_stats.max_lag_share, worst / bound);
+    if (worst > bound) {
+        fail("gearing lag", "%.1f steps over a bound of %.1f, %.3f steps a "
+             "count", worst, bound, steps_per_count);
+    }
+    int64_t scaled = counts * (int64_t)circle_steps;
+    int64_t exact = scaled / gear_counts;
+    if (exact * gear_counts != scaled && (scaled < 0) != (gear_counts < 0)) {
+        exact--; // rounded down
+    }
+    // settle then stop following, at the slowest acceleration an overshoot
+    // takes more than a second to come back from, it is measured on the
+    // table as the position jumps by the backlash when it is taken up
+    move_table();
+    int32_t side = table - start < exact ? 1 : -1;
+    int32_t overshoot = 0;
+    for (int ms = 0; ms < 10000; ms++) {
+        motion_service();
+        sim.advance(TICKS_PER_S / 1000);
+        move_table();
+        motion_get_status(&status);
+        int32_t past = (table - start - exact) * side;
+        overshoot = std::max(overshoot, past);
+        if (ms >= 1000 && status.position[0] - start == exact) {
+            break;
+        }
+    }
+    // an encoder that stops within the acceleration is stopped on, but
+    // the smoothed encoder speed takes a few slices to see the stop and
+    // it can go on by up to a count a slice until then, and by as far as
+    // the encoder slows in the slices queued ahead and those to see it
+    double seen = (slices - GEAR_CATCH_SLICES) * GEAR_SLICE_TICKS /
+                  TICKS_PER_S;
+    double allowed = GEAR_FILTER * ratio + 1 + accel * ratio * seen * seen / 2;
+    sim_stats.max_overshoot = std::max(sim_stats.max_overshoot, overshoot);
+    if (status.position[0] - start != exact || overshoot > allowed) {
+        fail("gearing stop", "at %d steps for %lld, overshoot %d steps of "
+             "%.1f, %.3f steps a count", (int)(status.position[0] - start),
+             (long long)exact, (int)overshoot, allowed, steps_per_count);
+    }
+    motion_gear(false);
+    do {
+        motion_service();
+        sim.advance(TICKS_PER_S / 1000);
+        motion_get_status(&status);
+    } while (status.running);
+    move_table();
+    set_current_position();
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim.trace.clear();
+    sim_stats.moves++;
+}
+
+// the home switch sees the flag once a turn, it interrupts as the table
+// comes to the flag and the motion task wakes at once
+static void flag_check() {
+    int64_t offset = ((int64_t)table - flag_start) % circle_steps;
+    if (offset < 0) {
+        offset += circle_steps;
+    }
+    bool in = offset < flag_width;
+    if (in && !flag_in) {
+        flag_edge = table;
+        home_edge();
+        sim.wake = true;
+    }
+    flag_in = in;
+}
+
+// the table follows the stepper at each step
+static void flag_step() {
+    move_table();
+    flag_check();
+}
+
+// home to a flag somewhere on the table in a random direction, the edge of
+// the flag it comes to has to end up exactly on the step of the home
+// offset
+void sim_homing() {
+    flag_start = random_int(0, circle_steps - 1);
+    flag_width = random_int(1, circle_steps / 8);
+    flag_in = false;
+    home_offset = degrees_to_angle(random_float(0, 360));
+    sim.on_step = [](int32_t) { flag_step(); };
+    flag_step();
+    motion_home(random_int(0, 1) ? 1 : -1);
+    motion_status_t status;
+    do {
+        motion_service();
+        sim.advance(TICKS_PER_S / 1000);
+        motion_get_status(&status);
+    } while (status.running);
+    sim.on_step = nullptr;
+    // the position has been set, so the table is too
+    int32_t shift = status.position[0] - table;
+    table += shift;
+    angle_t motor = home_offset + pitch_offset(home_offset);
+    if (!status.homed || flag_edge + shift != angle_to_steps(motor)) {
+        fail("homing", "flag edge at step %d for %d, homed %d",
+             (int)(flag_edge + shift), (int)angle_to_steps(motor),
+             (int)status.homed);
+    }
+    set_current_position();
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim.trace.clear();
+    sim_stats.moves++;
+}
+
+// the motor now and then slips a few full step cycles, 4 full steps each,
+// and loses the steps the stepper makes while it does
+static void slip_step(int32_t dir) {
+    if (slip_left > 0) {
+        slip_left--;
+        return;
+    }
+    motor += dir;
+    if (random_float(0, 1) < slip_chance) {
+        slips++;
+        slip_left = 4 * micro_steps * random_int(1, FEEDBACK_CORRECT / 2);
+    }
+}
+
+// count the encoder on the motor for its moves since start
+static void feed_encoder(int32_t start, int64_t *counts) {
+    int64_t scaled = (int64_t)(motor - start) * feedback_counts;
+    int64_t whole = scaled / circle_steps;
+    if (whole * circle_steps != scaled && scaled < 0) {
+        whole--; // rounded down
+    }
+    encoder_feed(whole - *counts);
+    *counts = whole;
+}
+
+// a few moves with a slipping motor and an encoder on it with at least a
+// count every 2 full steps, once the moves stop the motor has to be where
+// the steps say within the count it is left in and the count the steps
+// are in, or an alarm raised if it lost more than can be corrected or
+// the correction lost steps too, the alarm is then cleared, which takes
+// the position the encoder measured
+void sim_feedback() {
+    int32_t fewest = std::max<int32_t>(100, circle_steps / (2 * micro_steps));
+    fewest = std::min<int32_t>(fewest, MAX_GEAR_COUNTS);
+    feedback_counts = random_int(fewest, MAX_GEAR_COUNTS) *
+                      (random_int(0, 1) ? 1 : -1);
+    int32_t resolution =
+        (circle_steps + std::abs(feedback_counts) - 1) /
+        std::abs(feedback_counts);
+    int32_t limit = FEEDBACK_CORRECT * micro_steps;
+    set_feedback();
+    motion_service();
+    motor = sim.getCurrentPosition();
+    int32_t start = motor;
+    int64_t counts = 0;
+    slip_left = 0;
+    sim.on_step = slip_step;
+    motion_status_t status;
+    for (int i = 0; i < 4; i++) {
+        int32_t steps = random_float(-20, 20) * steps_per_degree;
+        slip_chance = 0.5 / (std::abs(steps) + 1);
+        uint64_t slipped = slips;
+        uint64_t moved = UINT64_MAX; // slips by the end of the move
+        int32_t worst = 0; // a stop ramp back can undo some of the error
+        motion_post(MOTION_MOVE, steps);
+        do {
+            motion_service();
+            sim.advance(TICKS_PER_S / 1000);
+            if (!sim.isRunning()) {
+                slip_left = 0; // a slip ends with the move
+                moved = std::min(moved, slips);
+            }
+            feed_encoder(start, &counts);
+            worst = std::max(worst, std::abs(sim.getCurrentPosition() - motor));
+            motion_service();
+            motion_get_status(&status);
+        } while (status.running);
+        int32_t error = std::abs(sim.getCurrentPosition() - motor);
+        if (status.alarm != MOTION_ALARM_NONE) {
+            // too many lost or the correction lost some too
+            if (worst <= limit - 2 * resolution && slips <= moved) {
+                fail("feedback alarm", "raised at %d lost steps, %d are "
+                     "corrected", (int)worst, (int)limit);
+            }
+            sim_stats.alarms++;
+            motion_post(MOTION_CLEAR_ALARM);
+            motion_service();
+            motion_get_status(&status);
+            error = std::abs(sim.getCurrentPosition() - motor);
+        } else if (slips != slipped) {
+            sim_stats.corrected++;
+        }
+        if (status.alarm != MOTION_ALARM_NONE || error > 2 * resolution) {
+            fail("feedback", "motor %d steps off, resolution %d, alarm %d",
+                 (int)error, (int)resolution, (int)status.alarm);
+        }
+        sim_stats.moves++;
+    }
+    sim.on_step = nullptr;
+    feedback_counts = 0;
+    set_feedback();
+    motion_service();
+    // carry on from where the motor is
+    motion_get_status(&status);
+    table = status.position[0];
+    set_current_position();
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim.trace.clear();
+}
+
+// serial replies since the last line sent
+static char replies[256];
+
+static void take_reply(const char *text) {
+    strncat(replies, text, sizeof(replies) - strlen(replies) - 1);
+}
+
+// send a line over the serial protocol and run it until it is answered,
+// the table isn't moving
+// returns the replies since the line before
+static const char *serial_line(const char *text) {
+    replies[0] = 0;
+    serial_set_writer(take_reply);
+    for (; *text; text++) {
+        serial_input(*text);
+    }
+    serial_input('\n');
+    while (serial_service()) {
+        motion_service();
+    }
+    serial_set_writer(NULL);
+    return replies;
+}
+
+// the stop button is pressed at a step of the move
+static void stop_step(int32_t) {
+    if (stop_at-- == 0) {
+        move_table();
+        estop_edge();
+        stop_edge = sim.getCurrentPosition();
+    } else if (stop_at < 0) {
+        sim_stats.stop_late++;
+    }
+}
+
+// press the emergency stop part way through a move, the move and anything
+// posted after it are held off until the button is released and the alarm
+// cleared over the serial protocol, a serial move is refused with an error
+// rather than an ok and the latched alarm is reported, the axis is no longer
+// homed as it stopped moving, the stepper is stopped on the step it was cut
+// at so it doesn't count the steps it made after that, which never reached
+// the motor, then the table is set again where it stopped
+void sim_estop() {
+    int32_t steps = random_float(2, 90) * steps_per_degree;
+    steps *= random_int(0, 1) ? 1 : -1;
+    stop_at = random_int(0, std::abs(steps) - 1);
+    sim.on_step = stop_step;
+    uint64_t late = sim_stats.stop_late;
+    bool running = false; // not stopped at the next service
+    motion_post(MOTION_MOVE, steps);
+    motion_status_t status;
+    do {
+        motion_service();
+        sim.advance(TICKS_PER_S / 1000);
+        move_table();
+        motion_service();
+        motion_get_status(&status);
+        running = running || (stop_at < 0 && sim.isRunning());
+    } while (status.running);
+    sim.on_step = nullptr;
+    if (running || sim_stats.stop_late != late) {
+        fail("estop stop", "%llu steps after the stop, running on %d",
+             (unsigned long long)(sim_stats.stop_late - late), (int)running);
+    }
+    if (stop_at >= 0 || status.alarm != MOTION_ALARM_ESTOP || status.homed ||
+        sim.cut) {
+        fail("estop alarm", "%d steps to the stop, alarm %d, homed %d, "
+             "cut %d", (int)stop_at, (int)status.alarm, (int)status.homed,
+             (int)sim.cut);
+    }
+    int32_t cut = std::abs(sim.getCurrentPosition() - stop_edge);
+    sim_stats.max_cut = std::max(sim_stats.max_cut, cut);
+    if (cut != 0 || !status.lost) {
+        fail("estop cut", "%d steps counted after the cut, lost %d", (int)cut,
+             (int)status.lost);
+    }
+    table += sim.getCurrentPosition() - stop_edge;
+    int32_t held = status.position[0];
+    const char *reply = serial_line("G1 A1");
+    if (!strstr(reply, "ALARM: emergency stop\n") ||
+        !strstr(reply, "error: alarm\n") || strstr(reply, "ok")) {
+        fail("estop serial move", "answered \"%s\"", reply);
+    }
+    motion_post(MOTION_MOVE, steps);
+    motion_post(MOTION_CLEAR_ALARM);
+    motion_post(MOTION_MOVE, steps);
+    motion_service();
+    motion_get_status(&status);
+    if (status.running || status.alarm != MOTION_ALARM_ESTOP ||
+        status.position[0] != held) {
+        fail("estop hold", "running %d, alarm %d, at step %d held at %d",
+             (int)status.running, (int)status.alarm, (int)status.position[0],
+             (int)held);
+    }
+    reply = serial_line("$X");
+    if (strcmp(reply, "error: stop pressed\n") != 0) {
+        fail("estop pressed", "$X answered \"%s\"", reply);
+    }
+    estop_release();
+    reply = serial_line("M999");
+    motion_get_status(&status);
+    if (strcmp(reply, "ok\n") != 0 || status.alarm != MOTION_ALARM_NONE) {
+        fail("estop clear", "M999 answered \"%s\", alarm %d", reply,
+             (int)status.alarm);
+    }
+    set_current_position();
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim.trace.clear();
+    sim_stats.stops++;
+    sim_stats.moves++;
+}
+
+// the motor stalls once the stepper goes faster or changes speed harder
+// than it can follow and loses the rest of the steps until the stepper
+// stops, the table is on the motor
+static void tune_step(int32_t dir) {
+    // v^2 goes up by twice the acceleration at each step of a ramp
+    double speed = std::abs(sim.getCurrentSpeedInMilliHz()) / 1000.0;
+    double accel = std::abs(speed * speed - last_speed * last_speed) / 2;
+    last_speed = speed;
+    stalled = stalled || speed > limit_speed || accel > limit_accel;
+    if (!stalled) {
+        motor += dir;
+    }
+    table = motor;
+    flag_check();
+}
+
+// a stopped motor starts the next move from rest and back in step
+static void motor_rest() {
+    if (!sim.isRunning()) {
+        last_speed = 0;
+        stalled = false;
+    }
+}
+
+// the speeds in degrees kept by tuning are the margin under what passed,
+// which is within the search resolution under the limit
+static bool tuned(int32_t degrees, double limit) {
+    double found = limit / (1 + TUNE_RESOLUTION / 100.0) - 1;
+    return degrees <= limit * TUNE_MARGIN / 100 + 0.01 &&
+           degrees >= found * TUNE_MARGIN / 100 - 1;
+}
+
+// tune the table against a motor with random limits, from rates it can
+// run at, checked by the encoder or the home flag, once done the table
+// has to be where the steps say
+void sim_tuning() {
+    micro_steps = micro_steps_list[random_int(0, 3)];
+    degrees_per_rev = degrees_per_rev_list[random_int(0, 6)];
+    degrees_jerk = 0;
+    backlash_steps = 0;
+    approach_direction = 0;
+    set_angle_per_step();
+    set_jerk();
+    set_backlash();
+    steps_per_degree = (double)steps_per_rev * micro_steps / degrees_per_rev;
+    // now and then a motor too weak for what tuning keeps
+    int32_t weak = random_int(0, 7);
+    double speed = weak == 1 ? random_float(1.5, TUNE_MIN_SPEED)
+                             : random_float(10, TUNE_MAX_SPEED);
+    // a motor starts at a low enough speed straight away so the
+    // acceleration would not matter, the limit is kept under that at the
+    // slowest speed the search can find
+    double slowest = 0.9 * (speed / (1 + TUNE_RESOLUTION / 100.0) - 1) *
+                     steps_per_degree;
+    double instant = slowest * slowest / 2 / steps_per_degree;
+    double accel = weak == 2 ? random_float(2, TUNE_MIN_ACCEL)
+                             : random_float(40, std::min(2000.0, instant));
+    limit_speed = speed * steps_per_degree;
+    limit_accel = accel * steps_per_degree;
+    degrees_per_sec = random_int(1, speed * 0.8);
+    degrees_accel = random_int(1, accel * 0.8);
+    int32_t old_speed = degrees_per_sec;
+    int32_t old_accel = degrees_accel;
+    set_step_rate();
+    set_acceleration();
+    bool encoder = random_int(0, 1);
+    feedback_counts = encoder ? circle_steps : 0;
+    set_feedback();
+    flag_start = random_int(0, circle_steps - 1);
+    flag_width = random_int(1, circle_steps / 8);
+    flag_in = false;
+    home_offset = degrees_to_angle(random_float(0, 360));
+    motion_service();
+    motor = sim.getCurrentPosition();
+    table = motor;
+    int32_t start = motor;
+    int64_t counts = 0;
+    slip_left = 0;
+    motor_rest();
+    sim.on_step = tune_step;
+    flag_check();
+    bool stored = false;
+    if (!tune_start()) {
+        fail("tuning start", "not started at %d deg/s, %d deg/s^2",
+             (int)degrees_per_sec, (int)degrees_accel);
+    }
+    while (tune_active()) {
+        motion_service();
+        sim.advance(TICKS_PER_S / 1000);
+        motor_rest();
+        if (encoder) {
+            feed_encoder(start, &counts);
+        }
+        motion_service();
+        motor_rest();
+        stored = tune_service();
+    }
+    if (weak == 1 || weak == 2) {
+        // given up with the rates left as they were
+        if (stored || degrees_per_sec != old_speed ||
+            degrees_accel != old_accel) {
+            fail("tuning weak motor", "stored %d, %d deg/s from %d, %d "
+                 "deg/s^2 from %d", (int)stored, (int)degrees_per_sec,
+                 (int)old_speed, (int)degrees_accel, (int)old_accel);
+        }
+    } else if (!stored || !tuned(degrees_per_sec, speed) ||
+               !tuned(degrees_accel, accel)) {
+        fail("tuning rates", "stored %d, %d deg/s for a limit of %.1f, %d "
+             "deg/s^2 for %.1f", (int)stored, (int)degrees_per_sec, speed,
+             (int)degrees_accel, accel);
+    }
+    motion_service(); // the alarm of the last trial is cleared
+    motion_status_t status;
+    motion_get_status(&status);
+    if (encoder) {
+        if (std::abs(sim.getCurrentPosition() - motor) > 1) {
+            fail("tuning position", "at step %d, the motor at %d",
+                 (int)sim.getCurrentPosition(), (int)motor);
+        }
+    } else if (status.homed) {
+        // homing again at the rates kept finds nothing lost
+        motion_home(1);
+        do {
+            motion_service();
+            sim.advance(TICKS_PER_S / 1000);
+            motor_rest();
+            motion_service();
+            motor_rest();
+            motion_get_status(&status);
+        } while (status.running);
+        if (!status.homed || status.home_shift % (int32_t)circle_steps) {
+            fail("tuning homing", "homed %d, shifted %d steps",
+                 (int)status.homed, (int)status.home_shift);
+        }
+    }
+    sim.on_step = nullptr;
+    feedback_counts = 0;
+    set_feedback();
+    motion_service();
+    motion_get_status(&status);
+    table = status.position[0];
+    set_current_position();
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim.trace.clear();
+    sim_stats.tunings++;
+    sim_stats.moves++;
+}
+
+// every motor steps per rev up to 500 with each microstep setting and
+// degrees per rev has exactly the steps in a turn, 120 x 256 at 1 degree
+// per rev came out a step short through the float angle of a step
+void sim_circle_steps() {
+    int32_t old_steps_per_rev = steps_per_rev;
+    int32_t old_micro_steps = micro_steps;
+    float old_degrees_per_rev = degrees_per_rev;
+    for (steps_per_rev = 1; steps_per_rev <= 500; steps_per_rev++) {
+        for (int32_t micro : micro_steps_list) {
+            for (float degrees : degrees_per_rev_list) {
+                micro_steps = micro;
+                degrees_per_rev = degrees;
+                set_angle_per_step();
+                int64_t steps = (int64_t)steps_per_rev * micro * 360;
+                int64_t exact = (2 * steps + (int64_t)degrees) /
+                                (2 * (int64_t)degrees);
+                if (circle_steps != exact) {
+                    sim_stats.wrong_circles++;
+                    fail("circle steps", "%u steps in a turn for %lld at %d "
+                         "x %d steps a rev of %g deg", (unsigned)circle_steps,
+                         (long long)exact, (int)steps_per_rev, (int)micro,
+                         degrees);
+                }
+            }
+        }
+    }
+    steps_per_rev = old_steps_per_rev;
+    micro_steps = old_micro_steps;
+    degrees_per_rev = old_degrees_per_rev;
+    set_angle_per_step();
+}
+
+// the exact new position of the table at a change of steps in a turn
+// has to be within half a step of it, whole turns and all
+static void check_rescale(int32_t before, uint32_t from) {
+    motion_status_t status;
+    motion_get_status(&status);
+    int64_t scaled = (int64_t)before * circle_steps;
+    int64_t error = (int64_t)status.position[0] * from - scaled;
+    if (std::abs((double)scaled / from) < INT32_MAX &&
+        std::abs(error) > from / 2) {
+        fail("drive change", "step %d of %u for step %d of %u",
+             (int)status.position[0], (unsigned)circle_steps, (int)before,
+             (unsigned)from);
+    }
+}
+
+// change the drive settings from under the table a few times and back,
+// each change is within half a step of where the table started, not of
+// the step the change before it rounded to, and changing back comes back
+// to the same step
+void sim_rescale() {
+    int32_t old_micro_steps = micro_steps;
+    float old_degrees_per_rev = degrees_per_rev;
+    uint32_t old_circle_steps = circle_steps;
+    motion_status_t status;
+    motion_get_status(&status);
+    int32_t start = status.position[0];
+    for (int32_t changes = random_int(1, 3); changes; changes--) {
+        micro_steps = micro_steps_list[random_int(0, 8)];
+        if (random_int(0, 1)) {
+            degrees_per_rev = degrees_per_rev_list[random_int(0, 20)];
+        }
+        set_drive();
+        motion_service();
+        check_rescale(start, old_circle_steps);
+    }
+    micro_steps = old_micro_steps;
+    degrees_per_rev = old_degrees_per_rev;
+    set_drive();
+    motion_service();
+    motion_get_status(&status);
+    if (status.position[0] != start) {
+        fail("drive change back", "step %d of %u for step %d",
+             (int)status.position[0], (unsigned)circle_steps, (int)start);
+    }
+    table = status.position[0];
+    set_current_position();
+    sim_stats.moves++;
+}
+
+// a few absolute moves in random directions
+void sim_absolute_moves() {
+    for (int i = 0; i < 10; i++) {
+        absolute_position = degrees_to_angle(random_float(0, 360));
+        motion_absolute_move(random_int(0, 1) ? 1 : -1);
+        finish_move();
+        check_position("absolute move", absolute_position * 360.0 / ANGLE_TURN);
+    }
+}
+
+// a few relative moves, each one should be within half a step of the
+// requested angle from where it started
+void sim_relative_moves() {
+    int32_t dir = random_int(0, 1) ? 1 : -1;
+    relative_move = degrees_to_angle(random_float(angle_per_step, 360));
+    double angle = relative_move * 360.0 / ANGLE_TURN;
+    for (int i = 0; i < 10; i++) {
+        double start = table_position() / steps_per_degree;
+        motion_relative_move(dir);
+        finish_move();
+        check_position("relative move", start + angle * dir);
+    }
+}
+
+// a run of relative serial moves the same way, without a jerk limit the
+// table only stops at the end, and again for a final approach, and it ends
+// up within a step of the angles from where it started
+void sim_blends() {
+    int32_t dir = random_int(0, 1) ? 1 : -1;
+    int32_t count = random_int(2, 5);
+    double angle = std::round(random_float(1, 30) * 1000) / 1000 * dir;
+    double start = table_position() / steps_per_degree;
+    char line[32];
+    snprintf(line, sizeof(line), "G0 A%.3f", angle);
+    serial_line("G91");
+    for (int32_t i = 0; i < count; i++) {
+        serial_line(line);
+    }
+    serial_line("G90");
+    int32_t stops = 0;
+    motion_status_t status;
+    do {
+        motion_service();
+        bool running = sim.isRunning();
+        sim.advance(TICKS_PER_S / 1000);
+        move_table();
+        if (running && !sim.isRunning()) {
+            stops++;
+        }
+        motion_service();
+        motion_get_status(&status);
+    } while (status.running || !motion_program_idle(status));
+    bool approach = approach_direction && backlash_steps &&
+                    dir != approach_direction;
+    if (degrees_jerk == 0 && stops != 1 + approach) {
+        fail("blend stops", "%d stops in %d moves, approach %d", (int)stops,
+             (int)count, (int)approach);
+    }
+    set_current_position();
+    // the protocol plans from the position it reads, so to within a step
+    double error =
+        table_position() - (start + angle * count) * steps_per_degree;
+    if (std::abs(error) > 1) {
+        fail("blend end", "%.3f steps off %d moves of %.3f deg", error,
+             (int)count, angle);
+    }
+#if STEP_TRACE
+    step_trace_end(NULL);
+#endif
+    sim_stats.moves += count;
+}
+
+// lines sent together are answered in their order, a move, an M code that
+// isn't a whole number or is too big and an M114 that reports where the
+// move ended
+void sim_serial_order() {
+    double angle = std::round(random_float(-30, 30) * 1000) / 1000;
+    char lines[96];
+    snprintf(lines, sizeof(lines),
+             "G91\nG0 A%.3f\nM114.5\nM99999999999\nM114\nG90\n", angle);
+    replies[0] = 0;
+    serial_set_writer(take_reply);
+    for (const char *c = lines; *c; c++) {
+        serial_input(*c);
+    }
+    motion_status_t status;
+    for (;;) {
+        bool waiting = serial_service();
+        motion_service();
+        motion_get_status(&status);
+        if (!waiting && !status.running && motion_program_idle(status)) {
+            break;
+        }
+        sim.advance(TICKS_PER_S / 1000);
+        move_table();
+    }
+    serial_set_writer(NULL);
+    set_current_position();
+    const char *expected = "ok\nok\nerror: bad M code\nerror: bad M code\n";
+    const char *report = strstr(replies, "steps:");
+    if (strncmp(replies, expected, strlen(expected)) != 0 || !report ||
+        atoi(report + 6) != status.position[0] ||
+        strcmp(strchr(report, '\n'), "\nok\nok\n") != 0) {
+        fail("serial order", "answered \"%s\" at step %d", replies,
+             (int)status.position[0]);
+    }
+    sim_stats.moves++;
+}
+
+// the stepper rates are whole steps so an axis only follows the scaled
+// ramp of a synchronised move closely when its rates are well above a step
+// per second, and it has enough steps to make a ramp
+static bool fine_rates(const int32_t *steps) {
+    double speed = INFINITY;    // slowest fraction of the move per second
+    double accel = INFINITY;    // and per second^2
+    double shortest = INFINITY; // fewest steps
+    for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+        double distance = std::abs(steps[axis]);
+        double steps_per_degree = 1 / axis_config[axis].angle_per_step;
+        speed = std::min(speed, degrees_per_sec * steps_per_degree / distance);
+        accel = std::min(accel, degrees_accel * steps_per_degree / distance);
+        shortest = std::min(shortest, distance);
+    }
+    return shortest >= 100 && speed * shortest >= 100 &&
+           accel * shortest >= 100;
+}
+
+// a few synchronised moves of both axes, the table can have backlash to
+// take up so its position is checked with it taken out
+void sim_sync_moves() {
+    for (int i = 0; i < 10; i++) {
+        // both axes start at the same time
+        if (tilt.now() < sim.now()) {
+            tilt.advance(sim.now() - tilt.now());
+        } else {
+            sim.advance(tilt.now() - sim.now());
+        }
+        uint64_t begin = sim.now();
+        int32_t steps[MOTION_AXES];
+        motion_status_t start;
+        motion_get_status(&start);
+        for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+            steps[axis] = random_int(-20000, 20000);
+            motion_post(MOTION_SYNC_STEPS, steps[axis], axis);
+        }
+        motion_post(MOTION_SYNC_MOVE);
+        motion_status_t status;
+        do {
+            motion_service();
+            sim.run_until_idle();
+            tilt.run_until_idle();
+            move_table();
+            motion_service();
+            motion_get_status(&status);
+        } while (status.running);
+        for (int32_t axis = 0; axis < MOTION_AXES; axis++) {
+            if (status.position[axis] != start.position[axis] + steps[axis]) {
+                fail("sync move", "axis %d at step %d for %d", (int)axis,
+                     (int)status.position[axis],
+                     (int)(start.position[axis] + steps[axis]));
+            }
+        }
+        double table_time = sim.now() - begin;
+        double tilt_time = tilt.now() - begin;
+        if (fine_rates(steps)) {
+            double error = std::abs(table_time - tilt_time) /
+                           std::max(table_time, tilt_time);
+            if (error > sim_stats.max_sync_error) {
+                sim_stats.max_sync_error = error;
+            }
+        }
+        sim_stats.moves++;
+    }
+    set_current_position();
+}
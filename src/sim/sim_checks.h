@@ -0,0 +1,62 @@
+// Rotary Table simulator checks
+//
+// each feature of the motion logic is run against the simulated steppers
+// with the random settings of a round and checked, a check that fails is
+// printed with its name, the seed and round and the values it failed on,
+// and counted, the simulator runs them all round after round and the unit
+// tests in test/ run each one on its own for a few rounds
+//
+// a round seeds its own random numbers from the seed and the round, so a
+// run can be started again from the round a failure was in
+
+#ifndef SIM_CHECKS_H
+#define SIM_CHECKS_H
+
+#include <stdint.h>
+
+#define SIM_SHOWN_FAILURES 10 // failures printed, the rest are counted
+#define SIM_FAILURE_SIZE 160  // length of the first failure kept
+
+// worst values over the rounds, for the report
+struct sim_stats_t {
+    uint64_t moves;          // moves made
+    double max_error;        // worst position error in steps
+    double max_time_error;   // worst move time estimate error
+    double max_sync_error;   // worst synchronised finish difference
+    double max_gear_lag;     // worst gearing lag in steps
+    double max_lag_share;    // worst gearing lag as a share of its bound
+    int32_t max_overshoot;   // worst gearing overshoot in steps
+    uint64_t corrected;      // moves with lost steps put back
+    uint64_t alarms;         // moves with too many lost steps
+    uint64_t stops;          // emergency stops
+    uint64_t stop_late;      // steps made after an emergency stop
+    int32_t max_cut;         // most steps counted with the output cut
+    uint32_t wrong_circles;  // drive settings off on the steps in a turn
+    uint64_t tunings;        // tuning runs
+    uint32_t failures;       // checks that failed
+    char failure[SIM_FAILURE_SIZE]; // the first of them
+};
+
+extern sim_stats_t sim_stats;
+
+void sim_begin(uint32_t seed, double tolerance);
+void sim_round(uint32_t round);
+
+void sim_circle_steps();
+void sim_divisions();
+void sim_division_program();
+void sim_program();
+void sim_milling();
+void sim_gearing();
+void sim_homing();
+void sim_feedback();
+void sim_estop();
+void sim_absolute_moves();
+void sim_relative_moves();
+void sim_blends();
+void sim_serial_order();
+void sim_sync_moves();
+void sim_tuning();
+void sim_rescale();
+
+#endif
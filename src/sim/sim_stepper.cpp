@@ -0,0 +1,312 @@
+// Rotary Table simulated stepper
+
+#include "sim_stepper.h"
+#include "../step_trace.h"
+#include <cmath>
+#include <cstdlib>
+
+int8_t SimStepper::move(int32_t steps, bool blocking) {
+    // like FastAccelStepper, a move while running is relative to the
+    // current target
+    start((mode == SIM_MOVE ? target : position) + steps);
+    if (blocking) {
+        run_until_idle();
+    }
+    return MOVE_OK;
+}
+
+int8_t SimStepper::moveTo(int32_t new_target, bool blocking) {
+    start(new_target);
+    if (blocking) {
+        run_until_idle();
+    }
+    return MOVE_OK;
+}
+
+int8_t SimStepper::runForward() {
+    applySpeedAcceleration();
+    if (mode == SIM_IDLE) {
+        speed = 0;
+        last_tick = clock;
+    }
+    dir = 1;
+    mode = SIM_RUN;
+    plan_step();
+    return MOVE_OK;
+}
+
+int8_t SimStepper::runBackward() {
+    applySpeedAcceleration();
+    if (mode == SIM_IDLE) {
+        speed = 0;
+        last_tick = clock;
+    }
+    dir = -1;
+    mode = SIM_RUN;
+    plan_step();
+    return MOVE_OK;
+}
+
+// like FastAccelStepper only a ramp is stopped, the raw queue runs out
+void SimStepper::stopMove() {
+    if (mode != SIM_IDLE && mode != SIM_QUEUE) {
+        mode = SIM_STOP;
+        plan_step();
+    }
+}
+
+void SimStepper::forceStop() {
+    mode = SIM_IDLE;
+    speed = 0;
+    target = position;
+}
+
+// like FastAccelStepper no further step is made, the raw queue included
+void SimStepper::forceStopAndNewPosition(int32_t new_position) {
+    mode = SIM_IDLE;
+    speed = 0;
+    queue_count = 0;
+    position = new_position;
+    target = new_position;
+}
+
+void SimStepper::setCurrentPosition(int32_t new_position) {
+    target += new_position - position;
+    position = new_position;
+}
+
+int8_t SimStepper::setSpeedInHz(uint32_t speed_hz) {
+    if (speed_hz == 0) {
+        return -1;
+    }
+    new_speed = speed_hz;
+    return MOVE_OK;
+}
+
+int8_t SimStepper::setAcceleration(int32_t step_s_s) {
+    if (step_s_s <= 0) {
+        return -1;
+    }
+    new_accel = step_s_s;
+    return MOVE_OK;
+}
+
+// like FastAccelStepper a new speed and acceleration are only used once a
+// move is started or they are applied
+void SimStepper::applySpeedAcceleration() {
+    max_speed = new_speed;
+    accel = new_accel;
+}
+
+// like FastAccelStepper the raw queue is only for a stepper that is not
+// running a ramp
+int8_t SimStepper::addQueueEntry(const stepper_command_s *command,
+                                 bool start) {
+    if (mode != SIM_IDLE && mode != SIM_QUEUE) {
+        return AQE_QUEUE_FULL;
+    }
+    if (queue_count == QUEUE_LEN) {
+        return AQE_QUEUE_FULL;
+    }
+    if (command->ticks == 0) {
+        return AQE_ERROR_TICKS_TOO_LOW;
+    }
+    queue[(queue_read + queue_count) % QUEUE_LEN] = *command;
+    queue_count++;
+    if (mode == SIM_IDLE && start) {
+        mode = SIM_QUEUE;
+        speed = 0;
+        last_tick = clock;
+        plan_step();
+    }
+    return AQE_OK;
+}
+
+// like FastAccelStepper the time left in the raw queue, the entry being
+// run is counted whole
+bool SimStepper::hasTicksInQueue(uint32_t min_ticks) {
+    uint64_t ticks = 0;
+    for (uint32_t i = 0; i < queue_count; i++) {
+        const stepper_command_s &command = queue[(queue_read + i) % QUEUE_LEN];
+        ticks += (uint64_t)command.ticks * (command.steps ? command.steps : 1);
+    }
+    return ticks >= min_ticks;
+}
+
+// start or retarget a move
+void SimStepper::start(int32_t new_target) {
+    applySpeedAcceleration();
+    target = new_target;
+    if (mode == SIM_IDLE) {
+        if (target == position) {
+            return;
+        }
+        dir = target > position ? 1 : -1;
+        speed = 0;
+        last_tick = clock;
+    }
+    mode = SIM_MOVE;
+    plan_step();
+}
+
+// work out the speed and time of the next step from a constant
+// acceleration ramp, or go idle if the motion is complete
+void SimStepper::plan_step() {
+    double a2 = 2.0 * accel;
+    int64_t remaining = 0;
+    bool decel;
+    bool ramp_down = false; // slowing to a stop rather than to max_speed
+    if (mode == SIM_MOVE) {
+        remaining = ((int64_t)target - position) * dir;
+        // the ramp is close enough to finish on target
+        if (remaining == 0) {
+            mode = SIM_IDLE;
+            speed = 0;
+            return;
+        }
+        // target is behind us, reverse once stopped
+        if (remaining < 0 && speed * speed <= a2) {
+            dir = -dir;
+            speed = 0;
+            remaining = -remaining;
+        }
+        ramp_down = remaining < 0 || speed * speed / a2 >= remaining;
+        // like FastAccelStepper a lower speed applied while moving is
+        // reached on the ramp
+        decel = ramp_down || speed > max_speed;
+    } else if (mode == SIM_STOP) {
+        if (speed * speed <= a2) {
+            mode = SIM_IDLE;
+            speed = 0;
+            target = position;
+            return;
+        }
+        ramp_down = true;
+        decel = true;
+    } else if (mode == SIM_RUN) {
+        decel = speed > max_speed;
+    } else if (mode == SIM_QUEUE) {
+        if (queue_count == 0) {
+            mode = SIM_IDLE;
+            speed = 0;
+            target = position;
+            if (clock < last_tick) {
+                clock = last_tick;
+            }
+            return;
+        }
+        dir = queue[queue_read].count_up ? 1 : -1;
+        next_speed = (double)TICKS_PER_S / queue[queue_read].ticks;
+        next_tick = last_tick + queue[queue_read].ticks;
+        return;
+    } else {
+        return;
+    }
+    double v2 = decel ? speed * speed - a2 : speed * speed + a2;
+    double v = v2 > 0 ? std::sqrt(v2) : 0;
+    if (decel ? !ramp_down && v < max_speed : v > max_speed) {
+        v = max_speed;
+    }
+    next_speed = v;
+    next_tick = last_tick + (uint64_t)(2.0 * TICKS_PER_S / (speed + v) + 0.5);
+}
+
+// make the planned step
+void SimStepper::step() {
+    // a pause only takes its time
+    if (mode == SIM_QUEUE && queue[queue_read].steps == 0) {
+        last_tick = next_tick;
+        if (clock < next_tick) {
+            clock = next_tick;
+        }
+        queue_read = (queue_read + 1) % QUEUE_LEN;
+        queue_count--;
+        plan_step();
+        return;
+    }
+    position += dir;
+    speed = next_speed;
+    step_count++;
+    last_tick = next_tick;
+    if (clock < next_tick) {
+        clock = next_tick;
+    }
+    if (mode == SIM_QUEUE && --queue[queue_read].steps == 0) {
+        queue_read = (queue_read + 1) % QUEUE_LEN;
+        queue_count--;
+    }
+    if (cut) {
+        // counted but never reaches the motor
+        plan_step();
+        return;
+    }
+    if (record) {
+        trace.push_back({next_tick, position});
+    }
+#if STEP_TRACE
+    if (timed) {
+        step_trace_record(next_tick);
+    }
+#endif
+    if (on_step) {
+        on_step(dir);
+    }
+    plan_step();
+}
+
+void SimStepper::advance(uint64_t ticks) {
+    uint64_t end = clock + ticks;
+    while (mode != SIM_IDLE && next_tick <= end) {
+        step();
+        if (wake) {
+            wake = false;
+            return;
+        }
+    }
+    clock = end;
+}
+
+void SimStepper::run_until_idle() {
+    // continuous runs never finish by themselves
+    if (mode == SIM_RUN) {
+        return;
+    }
+    // a fresh move that isn't being recorded can be finished in one go
+    if (mode == SIM_MOVE && !record && speed == 0) {
+        double steps = std::abs((int64_t)target - position);
+        double v = max_speed;
+        double t;
+        if (steps >= v * v / accel) {
+            t = steps / v + v / accel;
+        } else {
+            t = 2 * std::sqrt(steps / accel);
+        }
+        clock += (uint64_t)(t * TICKS_PER_S + 0.5);
+        step_count += (uint64_t)steps;
+        position = target;
+        mode = SIM_IDLE;
+        return;
+    }
+    // or a whole queue entry at a time
+    if (mode == SIM_QUEUE && !record) {
+        for (; queue_count; queue_count--) {
+            stepper_command_s &command = queue[queue_read];
+            position += command.count_up ? command.steps : -command.steps;
+            step_count += command.steps;
+            // a pause has no steps but still takes its ticks
+            last_tick += (uint64_t)command.ticks *
+                         (command.steps ? command.steps : 1);
+            queue_read = (queue_read + 1) % QUEUE_LEN;
+        }
+        if (clock < last_tick) {
+            clock = last_tick;
+        }
+        mode = SIM_IDLE;
+        speed = 0;
+        target = position;
+        return;
+    }
+    while (mode != SIM_IDLE) {
+        step();
+    }
+}
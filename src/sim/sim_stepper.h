@@ -0,0 +1,101 @@
+// Rotary Table simulated stepper
+//
+// a host side stand in for FastAccelStepper, it implements the subset of
+// the FastAccelStepper api used by the motion code, including the raw
+// command queue, and records every step with its timestamp so moves can be
+// checked and benchmarked off the ESP32
+
+#ifndef SIM_STEPPER_H
+#define SIM_STEPPER_H
+
+#include <stdint.h>
+#include <vector>
+
+// same tick rate as FastAccelStepper on the ESP32
+#define TICKS_PER_S 16000000L
+
+// fastest step rate, FastAccelStepper on the ESP32 manages 200kHz
+#define SIM_MAX_SPEED 200000
+
+// FastAccelStepper move result code
+#define MOVE_OK 0
+
+// FastAccelStepper queue entry result codes and queue length
+#define AQE_OK 0
+#define AQE_QUEUE_FULL 1
+#define AQE_ERROR_TICKS_TOO_LOW -1
+#define QUEUE_LEN 32
+
+// FastAccelStepper raw queue entry, steps at an interval of ticks
+struct stepper_command_s {
+    uint16_t ticks;
+    uint8_t steps;
+    bool count_up;
+};
+
+// one recorded step
+struct sim_step_t {
+    uint64_t ticks;   // time of the step
+    int32_t position; // position after the step
+};
+
+class SimStepper {
+  public:
+    // FastAccelStepper api
+    int8_t move(int32_t steps, bool blocking = false);
+    int8_t moveTo(int32_t position, bool blocking = false);
+    int8_t runForward();
+    int8_t runBackward();
+    void stopMove();
+    void forceStop();
+    void forceStopAndNewPosition(int32_t new_position);
+    int32_t getCurrentPosition() { return position; }
+    void setCurrentPosition(int32_t new_position);
+    int32_t targetPos() { return target; }
+    int32_t getCurrentSpeedInMilliHz() { return speed * dir * 1000; }
+    bool isRunning() { return mode != SIM_IDLE; }
+    int8_t setSpeedInHz(uint32_t speed_hz);
+    uint32_t getMaxSpeedInHz() { return SIM_MAX_SPEED; }
+    int8_t setAcceleration(int32_t step_s_s);
+    void applySpeedAcceleration();
+    int8_t addQueueEntry(const stepper_command_s *command, bool start = true);
+    bool hasTicksInQueue(uint32_t min_ticks);
+
+    // simulation control
+    void advance(uint64_t ticks); // run the stepper for a time period
+    void run_until_idle();        // finish the current move
+    uint64_t now() { return clock; }
+
+    bool record = false;                    // record each step in trace
+    bool timed = true;                      // steps go to the step trace build
+    bool cut = false;                       // step output held off the motor
+    bool wake = false;                      // end advance at this step
+    std::vector<sim_step_t> trace;          // recorded steps
+    uint64_t step_count = 0;                // total steps made
+    void (*on_step)(int32_t dir) = nullptr; // called after each step
+
+  private:
+    enum sim_mode_t { SIM_IDLE, SIM_MOVE, SIM_RUN, SIM_STOP, SIM_QUEUE };
+    void start(int32_t new_target);
+    void plan_step();
+    void step();
+
+    sim_mode_t mode = SIM_IDLE;
+    int32_t position = 0;
+    int32_t target = 0;
+    int32_t dir = 1;
+    double speed = 0;      // current speed in steps per second
+    double next_speed = 0; // speed after the next step
+    uint32_t max_speed = 1000;
+    int32_t accel = 1000;
+    uint32_t new_speed = 1000; // speed for the next move
+    int32_t new_accel = 1000;  // acceleration for the next move
+    uint64_t clock = 0;     // simulation time in ticks
+    uint64_t last_tick = 0; // time of the last step
+    uint64_t next_tick = 0; // time of the next step
+    stepper_command_s queue[QUEUE_LEN]; // raw queue entries
+    uint32_t queue_read = 0;            // oldest entry
+    uint32_t queue_count = 0;           // entries in the queue
+};
+
+#endif
@@ -0,0 +1,66 @@
+// Rotary Table single producer single consumer queue
+//
+// a lock free ring buffer for passing commands between two tasks, one
+// task only pushes and the other only pops so no locking is needed
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stdint.h>
+
+template <typename T, uint32_t SIZE> class SpscQueue {
+    static_assert((SIZE & (SIZE - 1)) == 0, "queue size must be a power of 2");
+
+  public:
+    // add an item, returns false if the queue is full
+    bool push(const T &item) {
+        uint32_t write = head.load(std::memory_order_relaxed);
+        if (write - tail.load(std::memory_order_acquire) == SIZE) {
+            return false;
+        }
+        items[write & (SIZE - 1)] = item;
+        head.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // take the oldest item, returns false if the queue is empty
+    bool pop(T &item) {
+        uint32_t read = tail.load(std::memory_order_relaxed);
+        if (read == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[read & (SIZE - 1)];
+        tail.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+    // the oldest item without taking it, returns false if the queue is
+    // empty
+    bool peek(T &item) {
+        uint32_t read = tail.load(std::memory_order_relaxed);
+        if (read == head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = items[read & (SIZE - 1)];
+        return true;
+    }
+
+    // free space, only accurate for the producer
+    uint32_t space() {
+        return SIZE - (head.load(std::memory_order_relaxed) -
+                       tail.load(std::memory_order_acquire));
+    }
+
+    bool empty() {
+        return tail.load(std::memory_order_acquire) ==
+               head.load(std::memory_order_acquire);
+    }
+
+  private:
+    T items[SIZE];
+    std::atomic<uint32_t> head{0}; // next item to write
+    std::atomic<uint32_t> tail{0}; // next item to read
+};
+
+#endif
@@ -0,0 +1,227 @@
+// Rotary Table step timing trace
+
+#include "step_trace.h"
+
+#if STEP_TRACE
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#if defined(ARDUINO)
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include <esp_pm.h>
+#include <soc/io_mux_reg.h>
+#else
+#include "sim/sim_stepper.h"
+#define IRAM_ATTR
+#endif
+
+#if defined(ARDUINO)
+// ring of step times from the step interrupt, read by the ui task
+static uint32_t ring[STEP_TRACE_SIZE];
+static std::atomic<uint32_t> ring_head{0}; // next time to write
+static std::atomic<uint32_t> ring_tail{0}; // next time to read
+static std::atomic<uint32_t> ring_lost{0}; // times dropped with it full
+static uint32_t rate;                      // cycle counter rate
+#if CONFIG_PM_ENABLE
+static esp_pm_lock_handle_t cpu_lock; // holds the cycle counter rate
+#endif
+#else
+static uint32_t rate = TICKS_PER_S; // simulator ticks
+#endif
+
+// the move being traced and all moves so far
+static step_trace_t move;
+static step_trace_t total;
+static uint32_t last_time;  // time of the last step
+static uint32_t interval_a; // interval two steps back
+static uint32_t interval_b; // interval one step back
+static uint32_t intervals;  // intervals in the move
+
+// emergency stop in the move, from its interrupt
+static std::atomic<bool> stopped{false}; // the move was stopped
+static uint32_t stop_time;               // time of the stop edge
+
+static void clear(step_trace_t *trace) {
+    memset(trace, 0, sizeof(*trace));
+    trace->min_interval = UINT32_MAX;
+}
+
+static uint32_t to_ns(uint64_t time) {
+    uint64_t ns = time * 1000000000 / rate;
+    return ns > UINT32_MAX ? UINT32_MAX : ns;
+}
+
+// add a jitter to a histogram, bin n is below STEP_TRACE_BIN_NS << n and
+// the last bin has everything above
+static void add_jitter(step_trace_t *trace, uint32_t jitter) {
+    int bin = 0;
+    uint32_t top = STEP_TRACE_BIN_NS;
+    while (bin < STEP_TRACE_BINS - 1 && jitter >= top) {
+        bin++;
+        top <<= 1;
+    }
+    trace->bins[bin]++;
+    if (jitter > trace->max_jitter) {
+        trace->max_jitter = jitter;
+    }
+}
+
+// add a step time to the move, the jitter of an interval is known once
+// the interval after it is
+static void add_step(uint32_t time) {
+    if (move.steps++ > 0) {
+        uint32_t interval = time - last_time;
+        uint32_t ns = to_ns(interval);
+        if (ns < move.min_interval) {
+            move.min_interval = ns;
+        }
+        if (ns > move.max_interval) {
+            move.max_interval = ns;
+        }
+        if (intervals >= 2) {
+            int64_t error = 2 * (int64_t)interval_b - interval_a - interval;
+            add_jitter(&move, to_ns(error < 0 ? -error : error) / 2);
+        }
+        interval_a = interval_b;
+        interval_b = interval;
+        intervals++;
+    }
+    last_time = time;
+}
+
+static void report(const char *name, const step_trace_t *trace,
+                   step_trace_write_t write) {
+    char text[64];
+    snprintf(text, sizeof(text), "# %s: %u steps, %u lost\n", name,
+             (unsigned)trace->steps, (unsigned)trace->lost);
+    write(text);
+    if (trace->stops) {
+        snprintf(text, sizeof(text),
+                 "# stops: %u, to the last step max %u nS\n",
+                 (unsigned)trace->stops, (unsigned)trace->max_stop);
+        write(text);
+    }
+    if (trace->steps < 2) {
+        return;
+    }
+    snprintf(text, sizeof(text), "# interval %u to %u nS, jitter max %u nS\n",
+             (unsigned)trace->min_interval, (unsigned)trace->max_interval,
+             (unsigned)trace->max_jitter);
+    write(text);
+    uint32_t top = STEP_TRACE_BIN_NS;
+    for (int i = 0; i < STEP_TRACE_BINS; i++, top <<= 1) {
+        if (trace->bins[i]) {
+            if (i < STEP_TRACE_BINS - 1) {
+                snprintf(text, sizeof(text), "#   < %u nS: %u\n",
+                         (unsigned)top, (unsigned)trace->bins[i]);
+            } else {
+                snprintf(text, sizeof(text), "#   >= %u nS: %u\n",
+                         (unsigned)(top >> 1), (unsigned)trace->bins[i]);
+            }
+            write(text);
+        }
+    }
+}
+
+#if defined(ARDUINO)
+static void IRAM_ATTR step_isr() { step_trace_record(ESP.getCycleCount()); }
+#endif
+
+// start tracing the pulses on the step pin, the simulator has no pin
+void step_trace_start(int pin) {
+    clear(&move);
+    clear(&total);
+#if defined(ARDUINO)
+#if CONFIG_PM_ENABLE
+    esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "trace", &cpu_lock);
+    esp_pm_lock_acquire(cpu_lock);
+#endif
+    rate = getCpuFrequencyMhz() * 1000000;
+    // read back the step output to interrupt on each pulse
+    PIN_INPUT_ENABLE(GPIO_PIN_MUX_REG[pin]);
+    attachInterrupt(pin, step_isr, RISING);
+#else
+    (void)pin;
+#endif
+}
+
+// note the time of a step
+void IRAM_ATTR step_trace_record(uint32_t time) {
+#if defined(ARDUINO)
+    uint32_t write = ring_head.load(std::memory_order_relaxed);
+    if (write - ring_tail.load(std::memory_order_acquire) == STEP_TRACE_SIZE) {
+        ring_lost.store(ring_lost.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+        return;
+    }
+    ring[write & (STEP_TRACE_SIZE - 1)] = time;
+    ring_head.store(write + 1, std::memory_order_release);
+#else
+    // the simulator steps in the thread that reads the trace
+    add_step(time);
+#endif
+}
+
+// note the time of an emergency stop during a move
+void IRAM_ATTR step_trace_stop(uint32_t time) {
+    stop_time = time;
+    stopped.store(true, std::memory_order_release);
+}
+
+// read the step times so far into the move
+void step_trace_service() {
+#if defined(ARDUINO)
+    uint32_t read = ring_tail.load(std::memory_order_relaxed);
+    uint32_t write = ring_head.load(std::memory_order_acquire);
+    for (; read != write; read++) {
+        add_step(ring[read & (STEP_TRACE_SIZE - 1)]);
+    }
+    ring_tail.store(read, std::memory_order_release);
+    move.lost += ring_lost.exchange(0);
+#endif
+}
+
+// the table has stopped, report the move if there is a write and add it
+// to the total
+void step_trace_end(step_trace_write_t write) {
+    step_trace_service();
+    if (stopped.exchange(false, std::memory_order_acquire) && move.steps) {
+        // steps up to the edge are before the stop
+        int32_t after = last_time - stop_time;
+        move.stops++;
+        move.max_stop = after > 0 ? to_ns(after) : 0;
+    }
+    if (move.steps == 0 && move.lost == 0) {
+        return;
+    }
+    if (write) {
+        report("move", &move, write);
+    }
+    total.steps += move.steps;
+    total.lost += move.lost;
+    if (move.min_interval < total.min_interval) {
+        total.min_interval = move.min_interval;
+    }
+    if (move.max_interval > total.max_interval) {
+        total.max_interval = move.max_interval;
+    }
+    if (move.max_jitter > total.max_jitter) {
+        total.max_jitter = move.max_jitter;
+    }
+    total.stops += move.stops;
+    if (move.max_stop > total.max_stop) {
+        total.max_stop = move.max_stop;
+    }
+    for (int i = 0; i < STEP_TRACE_BINS; i++) {
+        total.bins[i] += move.bins[i];
+    }
+    clear(&move);
+    intervals = 0;
+}
+
+// report all the moves so far
+void step_trace_total(step_trace_write_t write) {
+    report("total", &total, write);
+}
+#endif
@@ -0,0 +1,54 @@
+// Rotary Table step timing trace
+//
+// an instrumentation build, made with STEP_TRACE set to 1, timestamps every
+// step pulse, on the ESP32 from an interrupt on the step pin using the cpu
+// cycle counter and in the simulator from the simulated step times, each
+// interval is compared with the mean of the intervals either side of it so
+// the slow change of a ramp hardly shows, a histogram of the jitter is
+// reported at the end of each move and for all the moves together
+//
+// a move runs from when the table starts moving to when it stops, so a
+// program with no dwell is one move, the ESP32 times include the interrupt
+// latency so they are for comparing builds rather than an absolute measure
+// of the pulses
+//
+// an emergency stop during a move is timed from the edge of the button to
+// the last step, on the ESP32 both are cycle counter times taken in their
+// interrupts
+
+#ifndef STEP_TRACE_H
+#define STEP_TRACE_H
+
+#include <stdint.h>
+
+#ifndef STEP_TRACE
+#define STEP_TRACE 0 // 1 to build the step trace
+#endif
+#define STEP_TRACE_SIZE 4096 // step times held until the ui reads them
+#define STEP_TRACE_BINS 16   // jitter bins, each twice as wide as the last
+#define STEP_TRACE_BIN_NS 64 // top of the first bin in nS
+
+// step timing of a move or of all moves
+struct step_trace_t {
+    uint32_t steps;                 // steps traced
+    uint32_t lost;                  // steps missed with the ring full
+    uint32_t min_interval;          // shortest step interval in nS
+    uint32_t max_interval;          // longest step interval in nS
+    uint32_t max_jitter;            // worst jitter in nS
+    uint32_t bins[STEP_TRACE_BINS]; // jitter histogram
+    uint32_t stops;                 // emergency stops
+    uint32_t max_stop;              // longest from a stop to its last step
+                                    // in nS
+};
+
+// writes a line of the report
+typedef void (*step_trace_write_t)(const char *text);
+
+void step_trace_start(int pin);
+void step_trace_record(uint32_t time);
+void step_trace_stop(uint32_t time);
+void step_trace_service();
+void step_trace_end(step_trace_write_t write);
+void step_trace_total(step_trace_write_t write);
+
+#endif
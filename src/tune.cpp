@@ -0,0 +1,193 @@
+// Rotary Table tuning
+
+#include "tune.h"
+#include "home.h"
+#include "motion.h"
+#include <math.h>
+#include <stdlib.h>
+
+enum TUNE_STATE {
+    TUNE_IDLE,      // not tuning
+    TUNE_REFERENCE, // homing to know where the axis is
+    TUNE_TRIAL,     // test moves at the trial rates then the check
+};
+static uint8_t state;        // TUNE_STATE
+static bool home_check;      // checked by homing rather than the encoder
+static int32_t axis;         // axis being tuned
+static int32_t speed;        // speed found, 0 while it is searched for
+static int32_t passed;       // highest value that passed, 0 for none yet
+static int32_t failed;       // lowest value that failed, or past the most
+static int32_t trial;        // value being tried
+static uint32_t corrections; // encoder corrections before the trial
+
+// the next value to try, half way between the values that passed and
+// failed on a log scale
+// returns 0 once the search is within the resolution
+static int32_t search_next() {
+    if (failed - passed <= 1 ||
+        (int64_t)failed * 100 <= (int64_t)passed * (100 + TUNE_RESOLUTION)) {
+        return 0;
+    }
+    int32_t next = sqrtf((float)(passed ? passed : 1) * failed) + 0.5f;
+    if (next <= passed) {
+        return passed + 1;
+    } else if (next >= failed) {
+        return failed - 1;
+    }
+    return next;
+}
+
+// put back the rates and the feedback limit in use
+static void restore() {
+    set_step_rate();
+    set_acceleration();
+    set_feedback();
+}
+
+// home the axis at the rates in use, so the trials after it are checked
+// from where the switch is
+static void start_reference() {
+    restore();
+    motion_home(1, true);
+    state = TUNE_REFERENCE;
+}
+
+// run a trial, moves forward that reach the speed, all one way so lost
+// steps add up, then home to see where the axis really is if the encoder
+// can't say
+static void start_trial() {
+    motion_status_t status;
+    motion_get_status(&status);
+    corrections = status.corrections;
+    int32_t trial_speed = speed ? speed : trial;
+    int32_t trial_accel = speed ? trial : degrees_accel;
+    motion_post(MOTION_SET_SPEED, step_rate(axis, trial_speed), axis);
+    motion_post(MOTION_SET_ACCELERATION, step_rate(axis, trial_accel), axis);
+    // both ramps, the jerk lengthens them, and some time at speed
+    float degrees = (float)trial_speed * trial_speed / trial_accel +
+                    trial_speed * TUNE_CRUISE;
+    if (degrees_jerk) {
+        degrees += (float)trial_speed * trial_accel / degrees_jerk;
+    }
+    float steps = degrees / axis_config[axis].angle_per_step + 0.5f;
+    if (steps > 1e9f) {
+        steps = 1e9f;
+    }
+    int32_t move = steps > 1 ? steps : 1;
+    for (int32_t i = 0; i < TUNE_MOVES; i++) {
+        motion_program_post(MOTION_MOVE, move, axis);
+    }
+    if (home_check) {
+        motion_home(1, true);
+    }
+    state = TUNE_TRIAL;
+}
+
+// start tuning the selected axis, with the table encoder if it has one,
+// otherwise the home switch
+// returns false if there is no way to check it
+bool tune_start() {
+    axis = selected_axis;
+    home_check = axis != 0 || feedback_counts == 0;
+    if (home_check && HOME_PIN < 0) {
+        return false;
+    }
+    speed = 0;
+    passed = 0;
+    failed = TUNE_MAX_SPEED + 1;
+    trial = search_next();
+    if (home_check) {
+        start_reference();
+    } else {
+        // alarm rather than correct so a lost step fails the trial
+        motion_post(MOTION_FEEDBACK_LIMIT,
+                    TUNE_LOST * axis_config[0].micro_steps);
+        start_trial();
+    }
+    return true;
+}
+
+// give up, the rates in use are left as they were
+void tune_stop() {
+    if (state != TUNE_IDLE) {
+        state = TUNE_IDLE;
+        restore();
+    }
+}
+
+// tuning is in progress
+bool tune_active() { return state != TUNE_IDLE; }
+
+// run the next trial once the last one is done, from the ui loop
+// returns true once tuning has set new rates that want saving
+bool tune_service() {
+    motion_status_t status;
+    motion_get_status(&status);
+    if (state == TUNE_IDLE || status.running ||
+        !motion_program_idle(status)) {
+        return false;
+    }
+    if (status.alarm == MOTION_ALARM_ESTOP) {
+        tune_stop();
+        return false;
+    }
+    if (state == TUNE_REFERENCE) {
+        if (!status.homed) {
+            tune_stop(); // no switch
+            return false;
+        }
+        start_trial();
+        return false;
+    }
+    // the switch may have been found a turn on
+    axis_config_t &config = axis_config[axis];
+    int32_t shift = status.home_shift % (int32_t)config.circle_steps;
+    if (shift > (int32_t)config.circle_steps / 2) {
+        shift -= config.circle_steps;
+    } else if (shift < -(int32_t)config.circle_steps / 2) {
+        shift += config.circle_steps;
+    }
+    // a correction is steps lost too few to alarm
+    bool pass = status.alarm == MOTION_ALARM_NONE &&
+                status.corrections == corrections &&
+                (!home_check || (status.homed &&
+                                 abs(shift) <= TUNE_LOST * config.micro_steps));
+    if (status.alarm != MOTION_ALARM_NONE) {
+        // the position is then the one the encoder measured
+        motion_post(MOTION_CLEAR_ALARM);
+    }
+    if (pass) {
+        passed = trial;
+    } else {
+        failed = trial;
+    }
+    trial = search_next();
+    if (trial == 0 && speed == 0) {
+        // on to the acceleration at the speed found, an axis that can't
+        // go fast enough to be worth using is left as it was
+        if (passed * TUNE_MARGIN / 100 < TUNE_MIN_SPEED) {
+            tune_stop();
+            return false;
+        }
+        speed = passed;
+        passed = 0;
+        failed = TUNE_MAX_ACCEL + 1;
+        trial = search_next();
+    } else if (trial == 0) {
+        // too little acceleration would leave gearing and moves unusable
+        if (passed * TUNE_MARGIN / 100 < TUNE_MIN_ACCEL) {
+            tune_stop();
+            return false;
+        }
+        degrees_per_sec = speed * TUNE_MARGIN / 100;
+        degrees_accel = passed * TUNE_MARGIN / 100;
+        tune_stop();
+        return true;
+    }
+    if (home_check && !status.homed) {
+        start_reference();
+        return false;
+    }
+    start_trial();
+    return false;
+}
@@ -0,0 +1,43 @@
+// Rotary Table tuning
+//
+// finds the fastest speed and acceleration the selected axis can run at
+// without losing steps, each trial is a few moves forward long enough to
+// reach the speed on the ramp, run as a motion program, then
+// checked for lost steps, with the encoder feedback on the table if it
+// has an encoder, otherwise by homing and seeing how far the homing had
+// to move the position
+//
+// the speed is searched first at the acceleration in use, then the
+// acceleration at the speed found, each search halves the range it is
+// in on a log scale until it is within a few percent, so only a handful
+// of trials are run, the speeds in degrees kept are a margin below the
+// ones found and are shared by every axis, so tune the weaker axis, an
+// axis that can't keep a useful minimum is left as it was
+//
+// the encoder check alarms at a couple of lost full steps while tuning,
+// a trial that alarms or has a move corrected fails and the alarm is
+// cleared, homing checks home once before the first trial and again
+// whenever a trial couldn't find the switch, the acceleration in use has
+// to be one the axis can already run at
+
+#ifndef TUNE_H
+#define TUNE_H
+
+#include <stdint.h>
+
+#define TUNE_MAX_SPEED 100    // fastest speed tried in degrees per second
+#define TUNE_MAX_ACCEL 100000 // fastest acceleration tried in degrees/s^2
+#define TUNE_MIN_SPEED 5      // slowest speed kept in degrees per second
+#define TUNE_MIN_ACCEL 20     // slowest acceleration kept in degrees/s^2
+#define TUNE_RESOLUTION 5     // searches stop within this percent
+#define TUNE_MARGIN 80        // percent of the speeds found that is kept
+#define TUNE_MOVES 3          // test moves in each trial
+#define TUNE_CRUISE 0.2f      // seconds at speed in each test move
+#define TUNE_LOST 2           // most full steps out for a trial to pass
+
+bool tune_start();
+void tune_stop();
+bool tune_active();
+bool tune_service();
+
+#endif
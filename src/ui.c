@@ -9,36 +9,36 @@
 #include "vars.h"
 
 // ASSETS DEFINITION
-const uint8_t assets[18112] = {
+const uint8_t assets[30928] = {
     0x7E, 0x45, 0x45, 0x5A, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
     0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0xF0, 0x00, 0x40, 0x01, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x00,
-    0x5C, 0x41, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00,
+    0x20, 0x4A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
     0x00, 0x00, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
     0xB4, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0C, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00,
     0x64, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x7C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xB8, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x68, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x34, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xA4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x90, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xB0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x38, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x68, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0xBC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x40, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x28, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xC0, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1C, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0xD4, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x48, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0xF4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x5C, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x24, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xD4, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0xBC, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0xC8, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -854,9 +854,9 @@ const uint8_t assets[18112] = {
     0x01, 0x00, 0x00, 0x00, 0x8C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
     0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
     0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x0A, 0x00, 0x00, 0x00, 0x64, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x16, 0x00, 0x00, 0x00, 0x24, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
     0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
-    0x00, 0xE0, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0xA4, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
     0x68, 0x08, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x26, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
@@ -1141,7 +1141,808 @@ const uint8_t assets[18112] = {
     0x0A, 0x44, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x50, 0x65, 0x72, 0x20, 0x53, 0x65, 0x63,
     0x6F, 0x6E, 0x64, 0x20, 0x56, 0x65, 0x6C, 0x6F, 0x63, 0x69, 0x74, 0x79, 0x00, 0x00, 0x00, 0x00,
     0x0A, 0x44, 0x65, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x50, 0x65, 0x72, 0x20, 0x53, 0x65, 0x63,
-    0x6F, 0x6E, 0x64, 0x20, 0x5E, 0x32, 0x20, 0x41, 0x63, 0x63, 0x65, 0x6C, 0x00, 0x00, 0x00, 0x00
+    0x6F, 0x6E, 0x64, 0x20, 0x5E, 0x32, 0x20, 0x41, 0x63, 0x63, 0x65, 0x6C, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x6D, 0x73, 0x20, 0x44, 0x77, 0x65, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x0A, 0x44, 0x65, 0x67,
+    0x72, 0x65, 0x65, 0x73, 0x20, 0x50, 0x65, 0x72, 0x20, 0x53, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20,
+    0x5E, 0x33, 0x20, 0x4A, 0x65, 0x72, 0x6B, 0x00, 0x20, 0x73, 0x0A, 0x4D, 0x6F, 0x76, 0x65, 0x20,
+    0x54, 0x69, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x00, 0x20, 0x73, 0x0A, 0x43, 0x79, 0x63, 0x6C, 0x65,
+    0x20, 0x54, 0x69, 0x6D, 0x65, 0x00, 0x00, 0x00, 0x0A, 0x42, 0x61, 0x63, 0x6B, 0x6C, 0x61, 0x73,
+    0x68, 0x20, 0x53, 0x74, 0x65, 0x70, 0x73, 0x00, 0x0A, 0x41, 0x70, 0x70, 0x72, 0x6F, 0x61, 0x63,
+    0x68, 0x20, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x30, 0x20, 0x46,
+    0x6F, 0x72, 0x20, 0x45, 0x69, 0x74, 0x68, 0x65, 0x72, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x69, 0x74,
+    0x63, 0x68, 0x20, 0x4D, 0x61, 0x70, 0x20, 0x50, 0x6F, 0x69, 0x6E, 0x74, 0x00, 0x00, 0x00, 0x00,
+    0x0A, 0x50, 0x69, 0x74, 0x63, 0x68, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x41, 0x72, 0x63,
+    0x20, 0x53, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x73, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x54, 0x61, 0x62,
+    0x6C, 0x65, 0x5D, 0x00, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x00, 0x00, 0x00, 0x5B, 0x54, 0x69, 0x6C,
+    0x74, 0x5D, 0x00, 0x00, 0x54, 0x69, 0x6C, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x72, 0x6F,
+    0x67, 0x72, 0x61, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x25, 0x0A, 0x46, 0x65, 0x65, 0x64, 0x00, 0x00,
+    0x0A, 0x4D, 0x69, 0x6C, 0x6C, 0x20, 0x54, 0x75, 0x72, 0x6E, 0x73, 0x00, 0x0A, 0x4D, 0x69, 0x6C,
+    0x6C, 0x20, 0x45, 0x6E, 0x64, 0x00, 0x00, 0x00, 0x0A, 0x47, 0x65, 0x61, 0x72, 0x20, 0x43, 0x6F,
+    0x75, 0x6E, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x48, 0x6F, 0x6D, 0x65, 0x20, 0x53, 0x77,
+    0x69, 0x74, 0x63, 0x68, 0x20, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x00, 0x0A, 0x46, 0x65, 0x65,
+    0x64, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x45, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x72, 0x20, 0x43, 0x6F,
+    0x75, 0x6E, 0x74, 0x73, 0x00, 0x00, 0x00, 0x00, 0x53, 0x74, 0x61, 0x6C, 0x6C, 0x20, 0x41, 0x6C,
+    0x61, 0x72, 0x6D, 0x00, 0x45, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x53, 0x74,
+    0x6F, 0x70, 0x20, 0x41, 0x6C, 0x61, 0x72, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x50, 0x6F, 0x73, 0x69,
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4C, 0x6F, 0x73, 0x74, 0x2C, 0x20, 0x48, 0x6F, 0x6D, 0x65, 0x20,
+    0x4F, 0x72, 0x20, 0x53, 0x65, 0x74, 0x20, 0x49, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0xF8, 0xFF, 0xFF, 0x60, 0xF8, 0xFF, 0xFF, 0x6C, 0xF8, 0xFF, 0xFF, 0x78, 0xF8, 0xFF, 0xFF,
+    0x84, 0xF8, 0xFF, 0xFF, 0x90, 0xF8, 0xFF, 0xFF, 0x9C, 0xF8, 0xFF, 0xFF, 0xA8, 0xF8, 0xFF, 0xFF,
+    0xB4, 0xF8, 0xFF, 0xFF, 0xC0, 0xF8, 0xFF, 0xFF, 0xCC, 0xF8, 0xFF, 0xFF, 0xD8, 0xF8, 0xFF, 0xFF,
+    0xE4, 0xF8, 0xFF, 0xFF, 0xF0, 0xF8, 0xFF, 0xFF, 0xFC, 0xF8, 0xFF, 0xFF, 0x08, 0xF9, 0xFF, 0xFF,
+    0x14, 0xF9, 0xFF, 0xFF, 0x20, 0xF9, 0xFF, 0xFF, 0x2C, 0xF9, 0xFF, 0xFF, 0x38, 0xF9, 0xFF, 0xFF,
+    0x44, 0xF9, 0xFF, 0xFF, 0x50, 0xF9, 0xFF, 0xFF, 0x5C, 0xF9, 0xFF, 0xFF, 0x68, 0xF9, 0xFF, 0xFF,
+    0x74, 0xF9, 0xFF, 0xFF, 0x80, 0xF9, 0xFF, 0xFF, 0x8C, 0xF9, 0xFF, 0xFF, 0x98, 0xF9, 0xFF, 0xFF,
+    0xA4, 0xF9, 0xFF, 0xFF, 0xB0, 0xF9, 0xFF, 0xFF, 0xBC, 0xF9, 0xFF, 0xFF, 0xC8, 0xF9, 0xFF, 0xFF,
+    0xD4, 0xF9, 0xFF, 0xFF, 0xE0, 0xF9, 0xFF, 0xFF, 0xEC, 0xF9, 0xFF, 0xFF, 0xF8, 0xF9, 0xFF, 0xFF,
+    0x04, 0xFA, 0xFF, 0xFF, 0x10, 0xFA, 0xFF, 0xFF, 0x1C, 0xFA, 0xFF, 0xFF, 0x28, 0xFA, 0xFF, 0xFF,
+    0x34, 0xFA, 0xFF, 0xFF, 0x40, 0xFA, 0xFF, 0xFF, 0x4C, 0xFA, 0xFF, 0xFF, 0x58, 0xFA, 0xFF, 0xFF,
+    0x64, 0xFA, 0xFF, 0xFF, 0x9C, 0xFB, 0xFF, 0xFF, 0xA8, 0xFB, 0xFF, 0xFF, 0xB4, 0xFB, 0xFF, 0xFF,
+    0xC0, 0xFB, 0xFF, 0xFF, 0xCC, 0xFB, 0xFF, 0xFF, 0xD8, 0xFB, 0xFF, 0xFF, 0xE4, 0xFB, 0xFF, 0xFF,
+    0xF0, 0xFB, 0xFF, 0xFF, 0xFC, 0xFB, 0xFF, 0xFF, 0x08, 0xFC, 0xFF, 0xFF, 0x14, 0xFC, 0xFF, 0xFF,
+    0x20, 0xFC, 0xFF, 0xFF, 0x2C, 0xFC, 0xFF, 0xFF, 0x38, 0xFC, 0xFF, 0xFF, 0x44, 0xFC, 0xFF, 0xFF,
+    0x50, 0xFC, 0xFF, 0xFF, 0x5C, 0xFC, 0xFF, 0xFF, 0x68, 0xFC, 0xFF, 0xFF, 0x74, 0xFC, 0xFF, 0xFF,
+    0x80, 0xFC, 0xFF, 0xFF, 0x8C, 0xFC, 0xFF, 0xFF, 0x98, 0xFC, 0xFF, 0xFF, 0xA4, 0xFC, 0xFF, 0xFF,
+    0xB0, 0xFC, 0xFF, 0xFF, 0xBC, 0xFC, 0xFF, 0xFF, 0xC8, 0xFC, 0xFF, 0xFF, 0xD4, 0xFC, 0xFF, 0xFF,
+    0xE0, 0xFC, 0xFF, 0xFF, 0xEC, 0xFC, 0xFF, 0xFF, 0xF8, 0xFC, 0xFF, 0xFF, 0x04, 0xFD, 0xFF, 0xFF,
+    0x10, 0xFD, 0xFF, 0xFF, 0x1C, 0xFD, 0xFF, 0xFF, 0x28, 0xFD, 0xFF, 0xFF, 0x34, 0xFD, 0xFF, 0xFF,
+    0x2F, 0x00, 0x28, 0x00, 0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF,
+    0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF,
+    0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF, 0x18, 0xF5, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF,
+    0x30, 0x00, 0x29, 0x00, 0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF,
+    0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF,
+    0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF, 0xC0, 0xF4, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xFF,
+    0x31, 0x00, 0x2A, 0x00, 0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF,
+    0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF,
+    0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF, 0xB8, 0xF4, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0xFF,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x32, 0x00, 0x2B, 0x00, 0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF,
+    0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF,
+    0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF, 0x5C, 0xF4, 0xFF, 0xFF,
+    0x70, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0x33, 0x00, 0x2C, 0x00, 0x50, 0xF4, 0xFF, 0xFF,
+    0x50, 0xF4, 0xFF, 0xFF, 0x50, 0xF4, 0xFF, 0xFF, 0x50, 0xF4, 0xFF, 0xFF, 0x50, 0xF4, 0xFF, 0xFF,
+    0x50, 0xF4, 0xFF, 0xFF, 0x50, 0xF4, 0xFF, 0xFF, 0x50, 0xF4, 0xFF, 0xFF, 0x50, 0xF4, 0xFF, 0xFF,
+    0x50, 0xF4, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0xFF, 0x68, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF,
+    0x34, 0x00, 0x2D, 0x00, 0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF,
+    0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF,
+    0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF, 0xF0, 0xF3, 0xFF, 0xFF, 0x04, 0xFF, 0xFF, 0xFF,
+    0x64, 0xFF, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0xFF, 0x35, 0x00, 0x2E, 0x00, 0xE0, 0xF3, 0xFF, 0xFF,
+    0xE0, 0xF3, 0xFF, 0xFF, 0xE0, 0xF3, 0xFF, 0xFF, 0xE0, 0xF3, 0xFF, 0xFF, 0xE0, 0xF3, 0xFF, 0xFF,
+    0xE0, 0xF3, 0xFF, 0xFF, 0xE0, 0xF3, 0xFF, 0xFF, 0xE0, 0xF3, 0xFF, 0xFF, 0xE0, 0xF3, 0xFF, 0xFF,
+    0xE0, 0xF3, 0xFF, 0xFF, 0x9C, 0xFE, 0xFF, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF, 0x5C, 0xFF, 0xFF, 0xFF,
+    0xC8, 0xFF, 0xFF, 0xFF, 0x36, 0x00, 0x2F, 0x00, 0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF,
+    0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF,
+    0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF, 0x7C, 0xF3, 0xFF, 0xFF,
+    0x90, 0xFE, 0xFF, 0xFF, 0xF0, 0xFE, 0xFF, 0xFF, 0x58, 0xFF, 0xFF, 0xFF, 0xC8, 0xFF, 0xFF, 0xFF,
+    0x37, 0x00, 0x30, 0x00, 0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF,
+    0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF,
+    0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF, 0x68, 0xF3, 0xFF, 0xFF, 0x24, 0xFE, 0xFF, 0xFF,
+    0x80, 0xFE, 0xFF, 0xFF, 0xE4, 0xFE, 0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xFF,
+    0x38, 0x00, 0x31, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF,
+    0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF,
+    0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x00, 0xF3, 0xFF, 0xFF, 0x14, 0xFE, 0xFF, 0xFF,
+    0x74, 0xFE, 0xFF, 0xFF, 0xDC, 0xFE, 0xFF, 0xFF, 0x4C, 0xFF, 0xFF, 0xFF, 0xC4, 0xFF, 0xFF, 0xFF,
+    0x39, 0x00, 0x32, 0x00, 0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF,
+    0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF,
+    0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF, 0xE8, 0xF2, 0xFF, 0xFF, 0xA4, 0xFD, 0xFF, 0xFF,
+    0x00, 0xFE, 0xFF, 0xFF, 0x64, 0xFE, 0xFF, 0xFF, 0xD0, 0xFE, 0xFF, 0xFF, 0x44, 0xFF, 0xFF, 0xFF,
+    0xC0, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x33, 0x00, 0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF,
+    0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF,
+    0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF, 0x7C, 0xF2, 0xFF, 0xFF,
+    0x90, 0xFD, 0xFF, 0xFF, 0xF0, 0xFD, 0xFF, 0xFF, 0x58, 0xFE, 0xFF, 0xFF, 0xC8, 0xFE, 0xFF, 0xFF,
+    0x40, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x34, 0x00, 0x60, 0xF2, 0xFF, 0xFF,
+    0x60, 0xF2, 0xFF, 0xFF, 0x60, 0xF2, 0xFF, 0xFF, 0x60, 0xF2, 0xFF, 0xFF, 0x60, 0xF2, 0xFF, 0xFF,
+    0x60, 0xF2, 0xFF, 0xFF, 0x60, 0xF2, 0xFF, 0xFF, 0x60, 0xF2, 0xFF, 0xFF, 0x60, 0xF2, 0xFF, 0xFF,
+    0x60, 0xF2, 0xFF, 0xFF, 0x1C, 0xFD, 0xFF, 0xFF, 0x78, 0xFD, 0xFF, 0xFF, 0xDC, 0xFD, 0xFF, 0xFF,
+    0x48, 0xFE, 0xFF, 0xFF, 0xBC, 0xFE, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF,
+    0x3C, 0x00, 0x35, 0x00, 0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF,
+    0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF,
+    0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0xF0, 0xF1, 0xFF, 0xFF, 0x04, 0xFD, 0xFF, 0xFF,
+    0x64, 0xFD, 0xFF, 0xFF, 0xCC, 0xFD, 0xFF, 0xFF, 0x3C, 0xFE, 0xFF, 0xFF, 0xB4, 0xFE, 0xFF, 0xFF,
+    0x34, 0xFF, 0xFF, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x36, 0x00, 0xD0, 0xF1, 0xFF, 0xFF,
+    0xD0, 0xF1, 0xFF, 0xFF, 0xD0, 0xF1, 0xFF, 0xFF, 0xD0, 0xF1, 0xFF, 0xFF, 0xD0, 0xF1, 0xFF, 0xFF,
+    0xD0, 0xF1, 0xFF, 0xFF, 0xD0, 0xF1, 0xFF, 0xFF, 0xD0, 0xF1, 0xFF, 0xFF, 0xD0, 0xF1, 0xFF, 0xFF,
+    0xD0, 0xF1, 0xFF, 0xFF, 0x8C, 0xFC, 0xFF, 0xFF, 0xE8, 0xFC, 0xFF, 0xFF, 0x4C, 0xFD, 0xFF, 0xFF,
+    0xB8, 0xFD, 0xFF, 0xFF, 0x2C, 0xFE, 0xFF, 0xFF, 0xA8, 0xFE, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0xFF,
+    0xB8, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x37, 0x00, 0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF,
+    0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF,
+    0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF, 0x5C, 0xF1, 0xFF, 0xFF,
+    0x70, 0xFC, 0xFF, 0xFF, 0xD0, 0xFC, 0xFF, 0xFF, 0x38, 0xFD, 0xFF, 0xFF, 0xA8, 0xFD, 0xFF, 0xFF,
+    0x20, 0xFE, 0xFF, 0xFF, 0xA0, 0xFE, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0xFF, 0xB8, 0xFF, 0xFF, 0xFF,
+    0x3F, 0x00, 0x38, 0x00, 0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF,
+    0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF,
+    0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF, 0x38, 0xF1, 0xFF, 0xFF, 0xF4, 0xFB, 0xFF, 0xFF,
+    0x50, 0xFC, 0xFF, 0xFF, 0xB4, 0xFC, 0xFF, 0xFF, 0x20, 0xFD, 0xFF, 0xFF, 0x94, 0xFD, 0xFF, 0xFF,
+    0x10, 0xFE, 0xFF, 0xFF, 0x94, 0xFE, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0xFF,
+    0x40, 0x00, 0x39, 0x00, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF,
+    0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF,
+    0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xC0, 0xF0, 0xFF, 0xFF, 0xD4, 0xFB, 0xFF, 0xFF,
+    0x34, 0xFC, 0xFF, 0xFF, 0x9C, 0xFC, 0xFF, 0xFF, 0x0C, 0xFD, 0xFF, 0xFF, 0x84, 0xFD, 0xFF, 0xFF,
+    0x04, 0xFE, 0xFF, 0xFF, 0x8C, 0xFE, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0xFF,
+    0x41, 0x00, 0x3A, 0x00, 0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF,
+    0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF,
+    0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF, 0x98, 0xF0, 0xFF, 0xFF, 0x54, 0xFB, 0xFF, 0xFF,
+    0xB0, 0xFB, 0xFF, 0xFF, 0x14, 0xFC, 0xFF, 0xFF, 0x80, 0xFC, 0xFF, 0xFF, 0xF4, 0xFC, 0xFF, 0xFF,
+    0x70, 0xFD, 0xFF, 0xFF, 0xF4, 0xFD, 0xFF, 0xFF, 0x80, 0xFE, 0xFF, 0xFF, 0x14, 0xFF, 0xFF, 0xFF,
+    0xB0, 0xFF, 0xFF, 0xFF, 0x42, 0x00, 0x3B, 0x00, 0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF,
+    0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF,
+    0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF, 0x1C, 0xF0, 0xFF, 0xFF,
+    0x30, 0xFB, 0xFF, 0xFF, 0x90, 0xFB, 0xFF, 0xFF, 0xF8, 0xFB, 0xFF, 0xFF, 0x68, 0xFC, 0xFF, 0xFF,
+    0xE0, 0xFC, 0xFF, 0xFF, 0x60, 0xFD, 0xFF, 0xFF, 0xE8, 0xFD, 0xFF, 0xFF, 0x78, 0xFE, 0xFF, 0xFF,
+    0x10, 0xFF, 0xFF, 0xFF, 0xB0, 0xFF, 0xFF, 0xFF, 0x43, 0x00, 0x3C, 0x00, 0xF0, 0xEF, 0xFF, 0xFF,
+    0xF0, 0xEF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF,
+    0xF0, 0xEF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF, 0xF0, 0xEF, 0xFF, 0xFF,
+    0xF0, 0xEF, 0xFF, 0xFF, 0xAC, 0xFA, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF, 0x6C, 0xFB, 0xFF, 0xFF,
+    0xD8, 0xFB, 0xFF, 0xFF, 0x4C, 0xFC, 0xFF, 0xFF, 0xC8, 0xFC, 0xFF, 0xFF, 0x4C, 0xFD, 0xFF, 0xFF,
+    0xD8, 0xFD, 0xFF, 0xFF, 0x6C, 0xFE, 0xFF, 0xFF, 0x08, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF,
+    0x44, 0x00, 0x3D, 0x00, 0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF,
+    0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF,
+    0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF, 0x70, 0xEF, 0xFF, 0xFF, 0x84, 0xFA, 0xFF, 0xFF,
+    0xE4, 0xFA, 0xFF, 0xFF, 0x4C, 0xFB, 0xFF, 0xFF, 0xBC, 0xFB, 0xFF, 0xFF, 0x34, 0xFC, 0xFF, 0xFF,
+    0xB4, 0xFC, 0xFF, 0xFF, 0x3C, 0xFD, 0xFF, 0xFF, 0xCC, 0xFD, 0xFF, 0xFF, 0x64, 0xFE, 0xFF, 0xFF,
+    0x04, 0xFF, 0xFF, 0xFF, 0xAC, 0xFF, 0xFF, 0xFF, 0x45, 0x00, 0x3E, 0x00, 0x40, 0xEF, 0xFF, 0xFF,
+    0x40, 0xEF, 0xFF, 0xFF, 0x40, 0xEF, 0xFF, 0xFF, 0x40, 0xEF, 0xFF, 0xFF, 0x40, 0xEF, 0xFF, 0xFF,
+    0x40, 0xEF, 0xFF, 0xFF, 0x40, 0xEF, 0xFF, 0xFF, 0x40, 0xEF, 0xFF, 0xFF, 0x40, 0xEF, 0xFF, 0xFF,
+    0x40, 0xEF, 0xFF, 0xFF, 0xFC, 0xF9, 0xFF, 0xFF, 0x58, 0xFA, 0xFF, 0xFF, 0xBC, 0xFA, 0xFF, 0xFF,
+    0x28, 0xFB, 0xFF, 0xFF, 0x9C, 0xFB, 0xFF, 0xFF, 0x18, 0xFC, 0xFF, 0xFF, 0x9C, 0xFC, 0xFF, 0xFF,
+    0x28, 0xFD, 0xFF, 0xFF, 0xBC, 0xFD, 0xFF, 0xFF, 0x58, 0xFE, 0xFF, 0xFF, 0xFC, 0xFE, 0xFF, 0xFF,
+    0xA8, 0xFF, 0xFF, 0xFF, 0x46, 0x00, 0x3F, 0x00, 0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF,
+    0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF,
+    0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF, 0xBC, 0xEE, 0xFF, 0xFF,
+    0xD0, 0xF9, 0xFF, 0xFF, 0x30, 0xFA, 0xFF, 0xFF, 0x98, 0xFA, 0xFF, 0xFF, 0x08, 0xFB, 0xFF, 0xFF,
+    0x80, 0xFB, 0xFF, 0xFF, 0x00, 0xFC, 0xFF, 0xFF, 0x88, 0xFC, 0xFF, 0xFF, 0x18, 0xFD, 0xFF, 0xFF,
+    0xB0, 0xFD, 0xFF, 0xFF, 0x50, 0xFE, 0xFF, 0xFF, 0xF8, 0xFE, 0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0xFF,
+    0x14, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x4C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0xE0, 0x04, 0x00, 0x00, 0xE0,
+    0x05, 0x00, 0x00, 0xE0, 0x05, 0x00, 0x00, 0xE0, 0x06, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xCC, 0xFF, 0xFF, 0xFF, 0xF5, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xF5, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x06, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x20, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x41, 0x00,
+    0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x21, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x42, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x08, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00,
+    0x43, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x0A, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x22, 0x60, 0x1A, 0x00, 0x4F, 0xC0, 0x44, 0x00, 0x00, 0xC0, 0x00, 0xE0,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0,
+    0x07, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x00, 0x0B, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x23, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x46, 0x00,
+    0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1A, 0x00, 0x08, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x26, 0x60, 0x0F, 0x00,
+    0x0A, 0xC0, 0x4C, 0x00, 0x26, 0x60, 0x0A, 0x00, 0x0A, 0xC0, 0x4D, 0x00, 0x26, 0x60, 0x09, 0x00,
+    0x0A, 0xC0, 0x4E, 0x00, 0x4F, 0x00, 0x16, 0xC0, 0x16, 0xC0, 0x16, 0xC0, 0x00, 0xE0, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xFF,
+    0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xA9, 0xFF, 0xFF, 0x10, 0xAA, 0xFF, 0xFF, 0x2C, 0xAA, 0xFF, 0xFF, 0x48, 0xAA, 0xFF, 0xFF,
+    0x64, 0xAA, 0xFF, 0xFF, 0x80, 0xAA, 0xFF, 0xFF, 0x9C, 0xAA, 0xFF, 0xFF, 0xB8, 0xAA, 0xFF, 0xFF,
+    0xD4, 0xAA, 0xFF, 0xFF, 0xF0, 0xAA, 0xFF, 0xFF, 0x0C, 0xAB, 0xFF, 0xFF, 0x28, 0xAB, 0xFF, 0xFF,
+    0x44, 0xAB, 0xFF, 0xFF, 0x60, 0xAB, 0xFF, 0xFF, 0x7C, 0xAB, 0xFF, 0xFF, 0x98, 0xAB, 0xFF, 0xFF,
+    0xB4, 0xAB, 0xFF, 0xFF, 0xD0, 0xAB, 0xFF, 0xFF, 0xEC, 0xAB, 0xFF, 0xFF, 0x10, 0xAC, 0xFF, 0xFF,
+    0x34, 0xAC, 0xFF, 0xFF, 0x58, 0xAC, 0xFF, 0xFF, 0x78, 0xAC, 0xFF, 0xFF, 0x9C, 0xAC, 0xFF, 0xFF,
+    0xE0, 0xF6, 0xFF, 0xFF, 0x50, 0xF7, 0xFF, 0xFF, 0x8C, 0xF7, 0xFF, 0xFF, 0xC8, 0xF7, 0xFF, 0xFF,
+    0x0C, 0xF8, 0xFF, 0xFF, 0x40, 0xF8, 0xFF, 0xFF, 0x84, 0xF8, 0xFF, 0xFF, 0xB8, 0xF8, 0xFF, 0xFF,
+    0xFC, 0xF8, 0xFF, 0xFF, 0x30, 0xF9, 0xFF, 0xFF, 0x74, 0xF9, 0xFF, 0xFF, 0xB8, 0xF9, 0xFF, 0xFF,
+    0xFC, 0xF9, 0xFF, 0xFF, 0x30, 0xFA, 0xFF, 0xFF, 0x74, 0xFA, 0xFF, 0xFF, 0xA8, 0xFA, 0xFF, 0xFF,
+    0xF4, 0xFA, 0xFF, 0xFF, 0x38, 0xFB, 0xFF, 0xFF, 0x90, 0xFB, 0xFF, 0xFF, 0xDC, 0xFB, 0xFF, 0xFF,
+    0x20, 0xFC, 0xFF, 0xFF, 0x78, 0xFC, 0xFF, 0xFF, 0xBC, 0xFC, 0xFF, 0xFF, 0xF0, 0xFC, 0xFF, 0xFF,
+    0x34, 0xFD, 0xFF, 0xFF, 0x68, 0xFD, 0xFF, 0xFF, 0xB4, 0xFD, 0xFF, 0xFF, 0xF8, 0xFD, 0xFF, 0xFF,
+    0x50, 0xFE, 0xFF, 0xFF, 0xAC, 0xFE, 0xFF, 0xFF, 0xF0, 0xFE, 0xFF, 0xFF, 0x01, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x18, 0x60, 0x1A, 0x00, 0x4F, 0xC0, 0x31, 0x00, 0x00, 0xC0, 0x00, 0xE0,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xAD, 0xFF, 0xFF, 0x10, 0xAE, 0xFF, 0xFF, 0x2C, 0xAE, 0xFF, 0xFF, 0x48, 0xAE, 0xFF, 0xFF,
+    0x64, 0xAE, 0xFF, 0xFF, 0x80, 0xAE, 0xFF, 0xFF, 0x9C, 0xAE, 0xFF, 0xFF, 0xB8, 0xAE, 0xFF, 0xFF,
+    0xD4, 0xAE, 0xFF, 0xFF, 0xF0, 0xAE, 0xFF, 0xFF, 0x0C, 0xAF, 0xFF, 0xFF, 0x30, 0xAF, 0xFF, 0xFF,
+    0x54, 0xAF, 0xFF, 0xFF, 0x78, 0xAF, 0xFF, 0xFF, 0x98, 0xAF, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF,
+    0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x0A, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x16, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x2D, 0x00, 0x00, 0xC0, 0x00, 0xE0,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x05, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0,
+    0x07, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x19, 0x60, 0x1A, 0x00, 0x4F, 0xC0, 0x32, 0x00,
+    0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1E, 0x60, 0x05, 0x00, 0x0A, 0xC0, 0x3B, 0x00,
+    0x3C, 0x00, 0x16, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1E, 0x60, 0x0F, 0x00,
+    0x0A, 0xC0, 0x3D, 0x00, 0x3E, 0x00, 0x16, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x00, 0x0B, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1F, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x3F, 0x00,
+    0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x05, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xD8, 0xAB, 0xFF, 0xFF, 0xF4, 0xAB, 0xFF, 0xFF, 0x10, 0xAC, 0xFF, 0xFF, 0x2C, 0xAC, 0xFF, 0xFF,
+    0x48, 0xAC, 0xFF, 0xFF, 0x64, 0xAC, 0xFF, 0xFF, 0x80, 0xAC, 0xFF, 0xFF, 0x9C, 0xAC, 0xFF, 0xFF,
+    0xB8, 0xAC, 0xFF, 0xFF, 0xD4, 0xAC, 0xFF, 0xFF, 0xF0, 0xAC, 0xFF, 0xFF, 0x0C, 0xAD, 0xFF, 0xFF,
+    0x28, 0xAD, 0xFF, 0xFF, 0x44, 0xAD, 0xFF, 0xFF, 0x60, 0xAD, 0xFF, 0xFF, 0x7C, 0xAD, 0xFF, 0xFF,
+    0x98, 0xAD, 0xFF, 0xFF, 0xB4, 0xAD, 0xFF, 0xFF, 0xD0, 0xAD, 0xFF, 0xFF, 0xEC, 0xAD, 0xFF, 0xFF,
+    0x10, 0xAE, 0xFF, 0xFF, 0x34, 0xAE, 0xFF, 0xFF, 0x58, 0xAE, 0xFF, 0xFF, 0x7C, 0xAE, 0xFF, 0xFF,
+    0xA0, 0xAE, 0xFF, 0xFF, 0xC0, 0xAE, 0xFF, 0xFF, 0xE0, 0xAE, 0xFF, 0xFF, 0x04, 0xAF, 0xFF, 0xFF,
+    0x28, 0xAF, 0xFF, 0xFF, 0xB4, 0xFB, 0xFF, 0xFF, 0xF8, 0xFB, 0xFF, 0xFF, 0x2C, 0xFC, 0xFF, 0xFF,
+    0x78, 0xFC, 0xFF, 0xFF, 0xBC, 0xFC, 0xFF, 0xFF, 0x14, 0xFD, 0xFF, 0xFF, 0x58, 0xFD, 0xFF, 0xFF,
+    0x9C, 0xFD, 0xFF, 0xFF, 0xE4, 0xFD, 0xFF, 0xFF, 0x28, 0xFE, 0xFF, 0xFF, 0x70, 0xFE, 0xFF, 0xFF,
+    0xBC, 0xFE, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x01,
+    0x03, 0x03, 0x03, 0x03, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1E, 0x60, 0x05, 0x00, 0x0A, 0xC0, 0x3B, 0x00,
+    0x3C, 0x00, 0x16, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1E, 0x60, 0x0F, 0x00,
+    0x0A, 0xC0, 0x3D, 0x00, 0x3E, 0x00, 0x16, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF,
+    0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF, 0xFF, 0xE4, 0xAD, 0xFF, 0xFF,
+    0x00, 0xAE, 0xFF, 0xFF, 0x1C, 0xAE, 0xFF, 0xFF, 0x38, 0xAE, 0xFF, 0xFF, 0x54, 0xAE, 0xFF, 0xFF,
+    0x70, 0xAE, 0xFF, 0xFF, 0x8C, 0xAE, 0xFF, 0xFF, 0xA8, 0xAE, 0xFF, 0xFF, 0xC4, 0xAE, 0xFF, 0xFF,
+    0xE0, 0xAE, 0xFF, 0xFF, 0xFC, 0xAE, 0xFF, 0xFF, 0x18, 0xAF, 0xFF, 0xFF, 0x34, 0xAF, 0xFF, 0xFF,
+    0x50, 0xAF, 0xFF, 0xFF, 0x6C, 0xAF, 0xFF, 0xFF, 0x88, 0xAF, 0xFF, 0xFF, 0xA4, 0xAF, 0xFF, 0xFF,
+    0xC0, 0xAF, 0xFF, 0xFF, 0xDC, 0xAF, 0xFF, 0xFF, 0xF8, 0xAF, 0xFF, 0xFF, 0x14, 0xB0, 0xFF, 0xFF,
+    0x30, 0xB0, 0xFF, 0xFF, 0x4C, 0xB0, 0xFF, 0xFF, 0x68, 0xB0, 0xFF, 0xFF, 0x84, 0xB0, 0xFF, 0xFF,
+    0xA8, 0xB0, 0xFF, 0xFF, 0xCC, 0xB0, 0xFF, 0xFF, 0xF0, 0xB0, 0xFF, 0xFF, 0x14, 0xB1, 0xFF, 0xFF,
+    0x64, 0xFE, 0xFF, 0xFF, 0xA8, 0xFE, 0xFF, 0xFF, 0xF0, 0xFE, 0xFF, 0xFF, 0x34, 0xFF, 0xFF, 0xFF,
+    0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x0E, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x17, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x2F, 0x00, 0x00, 0xC0, 0x00, 0xE0,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0,
+    0x07, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x0F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1A, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x33, 0x00,
+    0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x09, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x10, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x1B, 0x60, 0x14, 0x00,
+    0x4F, 0xC0, 0x35, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0xE0,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x11, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x1C, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x37, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x12, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x1D, 0x60, 0x14, 0x00, 0x4F, 0xC0, 0x39, 0x00, 0x00, 0xC0, 0x00, 0xE0,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0,
+    0x07, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x2C, 0x00, 0x13, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x24, 0x60, 0x1A, 0x00, 0x4F, 0xC0, 0x48, 0x00,
+    0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x08, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0xE0, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x14, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0x30, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x25, 0x60, 0x14, 0x00,
+    0x4F, 0xC0, 0x4A, 0x00, 0x00, 0xC0, 0x00, 0xE0, 0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF,
+    0xE8, 0xFF, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00,
+    0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x15, 0x00, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x4B, 0x00, 0x00, 0xE0,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x32, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x30, 0x75, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0xE0, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF0, 0xA8, 0xFF, 0xFF, 0x0C, 0xA9, 0xFF, 0xFF, 0x28, 0xA9, 0xFF, 0xFF,
+    0x44, 0xA9, 0xFF, 0xFF, 0x60, 0xA9, 0xFF, 0xFF, 0x7C, 0xA9, 0xFF, 0xFF, 0x98, 0xA9, 0xFF, 0xFF,
+    0xB4, 0xA9, 0xFF, 0xFF, 0xD0, 0xA9, 0xFF, 0xFF, 0xEC, 0xA9, 0xFF, 0xFF, 0x08, 0xAA, 0xFF, 0xFF,
+    0x24, 0xAA, 0xFF, 0xFF, 0x40, 0xAA, 0xFF, 0xFF, 0x5C, 0xAA, 0xFF, 0xFF, 0x80, 0xAA, 0xFF, 0xFF,
+    0xA4, 0xAA, 0xFF, 0xFF, 0xC8, 0xAA, 0xFF, 0xFF, 0xEC, 0xAA, 0xFF, 0xFF, 0x10, 0xAB, 0xFF, 0xFF,
+    0x34, 0xAB, 0xFF, 0xFF, 0x58, 0xAB, 0xFF, 0xFF, 0x78, 0xAB, 0xFF, 0xFF, 0x98, 0xAB, 0xFF, 0xFF,
+    0xBC, 0xAB, 0xFF, 0xFF, 0xE0, 0xAB, 0xFF, 0xFF, 0x04, 0xAC, 0xFF, 0xFF, 0x28, 0xAC, 0xFF, 0xFF,
+    0x68, 0xF7, 0xFF, 0xFF, 0xB4, 0xF7, 0xFF, 0xFF, 0xF8, 0xF7, 0xFF, 0xFF, 0x50, 0xF8, 0xFF, 0xFF,
+    0x9C, 0xF8, 0xFF, 0xFF, 0xE0, 0xF8, 0xFF, 0xFF, 0x38, 0xF9, 0xFF, 0xFF, 0x84, 0xF9, 0xFF, 0xFF,
+    0xC8, 0xF9, 0xFF, 0xFF, 0x20, 0xFA, 0xFF, 0xFF, 0x6C, 0xFA, 0xFF, 0xFF, 0xB0, 0xFA, 0xFF, 0xFF,
+    0x08, 0xFB, 0xFF, 0xFF, 0x54, 0xFB, 0xFF, 0xFF, 0x98, 0xFB, 0xFF, 0xFF, 0xF0, 0xFB, 0xFF, 0xFF,
+    0x3C, 0xFC, 0xFF, 0xFF, 0x80, 0xFC, 0xFF, 0xFF, 0xD8, 0xFC, 0xFF, 0xFF, 0x1C, 0xFD, 0xFF, 0xFF,
+    0x50, 0xFD, 0xFF, 0xFF, 0x94, 0xFD, 0xFF, 0xFF, 0xC8, 0xFD, 0xFF, 0xFF, 0x14, 0xFE, 0xFF, 0xFF,
+    0x58, 0xFE, 0xFF, 0xFF, 0xB0, 0xFE, 0xFF, 0xFF, 0xF4, 0xFE, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x00, 0x00, 0x00, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x2E, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x28, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xE0, 0x2E, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x0D, 0x60, 0x2E, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x29, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0,
+    0x2E, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x30, 0x00,
+    0x0A, 0xC0, 0x00, 0xE0, 0x2A, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x30, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x30, 0x00, 0x0A, 0xC0, 0x00, 0xE0,
+    0x2B, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x30, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x34, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x2C, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xE0, 0x34, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x0D, 0x60, 0x34, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x2D, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0,
+    0x34, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x36, 0x00,
+    0x0A, 0xC0, 0x00, 0xE0, 0x2E, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x36, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x36, 0x00, 0x0A, 0xC0, 0x00, 0xE0,
+    0x2F, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x36, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x38, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x30, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xE0, 0x38, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x0D, 0x60, 0x38, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x31, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0,
+    0x38, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x3A, 0x00,
+    0x0A, 0xC0, 0x00, 0xE0, 0x32, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x3A, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x3A, 0x00, 0x0A, 0xC0, 0x00, 0xE0,
+    0x33, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x3A, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x40, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x34, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xE0, 0x40, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x0D, 0x60, 0x40, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x35, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0,
+    0x40, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x43, 0x00,
+    0x0A, 0xC0, 0x00, 0xE0, 0x36, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x43, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x43, 0x00, 0x0A, 0xC0, 0x00, 0xE0,
+    0x37, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x43, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x45, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xE0, 0x45, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x17, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x0D, 0x60, 0x45, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x39, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0,
+    0x45, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x47, 0x00,
+    0x0A, 0xC0, 0x00, 0xE0, 0x3A, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x47, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x47, 0x00, 0x0A, 0xC0, 0x00, 0xE0,
+    0x3B, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x47, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x49, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x00,
+    0x0D, 0x60, 0x00, 0xE0, 0x49, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x00, 0x17, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF,
+    0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+    0x0D, 0x60, 0x49, 0x00, 0x0A, 0xC0, 0x00, 0xE0, 0x3D, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0,
+    0x49, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00,
+    0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00,
+    0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x4B, 0x00,
+    0x0A, 0xC0, 0x00, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x4B, 0x00, 0x00, 0xE0,
+    0x00, 0xE0, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xFF, 0xF1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x58, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0D, 0x60, 0x4B, 0x00, 0x0A, 0xC0, 0x00, 0xE0,
+    0x3F, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x00, 0xE0, 0x4B, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00,
+    0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x19, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 0xFF,
+    0xEC, 0xFF, 0xFF, 0xFF, 0x28, 0xA0, 0xFF, 0xFF, 0x44, 0xA0, 0xFF, 0xFF, 0x60, 0xA0, 0xFF, 0xFF,
+    0x7C, 0xA0, 0xFF, 0xFF, 0x98, 0xA0, 0xFF, 0xFF, 0xB4, 0xA0, 0xFF, 0xFF, 0xD0, 0xA0, 0xFF, 0xFF,
+    0xEC, 0xA0, 0xFF, 0xFF, 0x10, 0xA1, 0xFF, 0xFF, 0x34, 0xA1, 0xFF, 0xFF, 0x58, 0xA1, 0xFF, 0xFF,
+    0x7C, 0xA1, 0xFF, 0xFF, 0xA0, 0xA1, 0xFF, 0xFF, 0xC4, 0xA1, 0xFF, 0xFF, 0xE8, 0xA1, 0xFF, 0xFF,
+    0x08, 0xA2, 0xFF, 0xFF, 0x28, 0xA2, 0xFF, 0xFF, 0x4C, 0xA2, 0xFF, 0xFF, 0x70, 0xA2, 0xFF, 0xFF,
+    0x94, 0xA2, 0xFF, 0xFF, 0xB8, 0xA2, 0xFF, 0xFF, 0xDC, 0xA2, 0xFF, 0xFF, 0x00, 0xA3, 0xFF, 0xFF,
+    0x20, 0xA3, 0xFF, 0xFF, 0x44, 0xA3, 0xFF, 0xFF, 0x64, 0xA3, 0xFF, 0xFF, 0x88, 0xA3, 0xFF, 0xFF,
+    0xAC, 0xA3, 0xFF, 0xFF, 0xD0, 0xA3, 0xFF, 0xFF, 0xF4, 0xA3, 0xFF, 0xFF, 0x18, 0xA4, 0xFF, 0xFF,
+    0x3C, 0xA4, 0xFF, 0xFF, 0x60, 0xA4, 0xFF, 0xFF, 0x84, 0xA4, 0xFF, 0xFF, 0xA8, 0xA4, 0xFF, 0xFF,
+    0xCC, 0xA4, 0xFF, 0xFF, 0xF0, 0xA4, 0xFF, 0xFF, 0x14, 0xA5, 0xFF, 0xFF, 0x38, 0xA5, 0xFF, 0xFF,
+    0x5C, 0xA5, 0xFF, 0xFF, 0x80, 0xA5, 0xFF, 0xFF, 0xA4, 0xA5, 0xFF, 0xFF, 0xC8, 0xA5, 0xFF, 0xFF,
+    0xEC, 0xA5, 0xFF, 0xFF, 0x10, 0xA6, 0xFF, 0xFF, 0x34, 0xA6, 0xFF, 0xFF, 0x58, 0xA6, 0xFF, 0xFF,
+    0xA4, 0xF3, 0xFF, 0xFF, 0x1C, 0xF4, 0xFF, 0xFF, 0x94, 0xF4, 0xFF, 0xFF, 0x0C, 0xF5, 0xFF, 0xFF,
+    0x84, 0xF5, 0xFF, 0xFF, 0xFC, 0xF5, 0xFF, 0xFF, 0x74, 0xF6, 0xFF, 0xFF, 0xEC, 0xF6, 0xFF, 0xFF,
+    0x64, 0xF7, 0xFF, 0xFF, 0xDC, 0xF7, 0xFF, 0xFF, 0x54, 0xF8, 0xFF, 0xFF, 0xCC, 0xF8, 0xFF, 0xFF,
+    0x44, 0xF9, 0xFF, 0xFF, 0xBC, 0xF9, 0xFF, 0xFF, 0x34, 0xFA, 0xFF, 0xFF, 0xAC, 0xFA, 0xFF, 0xFF,
+    0x24, 0xFB, 0xFF, 0xFF, 0x9C, 0xFB, 0xFF, 0xFF, 0x14, 0xFC, 0xFF, 0xFF, 0x8C, 0xFC, 0xFF, 0xFF,
+    0x04, 0xFD, 0xFF, 0xFF, 0x7C, 0xFD, 0xFF, 0xFF, 0xF4, 0xFD, 0xFF, 0xFF, 0x6C, 0xFE, 0xFF, 0xFF,
+    0x01, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03
 };
 
 native_var_t native_vars[] = {
@@ -1166,6 +1967,23 @@ native_var_t native_vars[] = {
     { NATIVE_VAR_TYPE_INTEGER, get_var_micro_steps, set_var_micro_steps }, 
     { NATIVE_VAR_TYPE_FLOAT, get_var_relative_move, set_var_relative_move }, 
     { NATIVE_VAR_TYPE_INTEGER, get_var_steps_per_rev, set_var_steps_per_rev }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_division_dwell, set_var_division_dwell }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_degrees_jerk, set_var_degrees_jerk }, 
+    { NATIVE_VAR_TYPE_FLOAT, get_var_move_time, set_var_move_time }, 
+    { NATIVE_VAR_TYPE_FLOAT, get_var_cycle_time, set_var_cycle_time }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_backlash_steps, set_var_backlash_steps }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_approach_direction, set_var_approach_direction }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_pitch_point, set_var_pitch_point }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_pitch_error, set_var_pitch_error }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_selected_axis, set_var_selected_axis }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_program_slot, set_var_program_slot }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_feed_override, set_var_feed_override }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_mill_turns, set_var_mill_turns }, 
+    { NATIVE_VAR_TYPE_FLOAT, get_var_mill_end, set_var_mill_end }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_gear_counts, set_var_gear_counts }, 
+    { NATIVE_VAR_TYPE_FLOAT, get_var_home_offset, set_var_home_offset }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_feedback_counts, set_var_feedback_counts }, 
+    { NATIVE_VAR_TYPE_INTEGER, get_var_motion_alarm, set_var_motion_alarm }, 
 };
 
 
@@ -1183,6 +2001,14 @@ ActionExecFunc actions[] = {
     action_set_input_float,
     action_set_input_int,
     action_set_zero,
+    action_run_divisions,
+    action_select_axis,
+    action_mill,
+    action_feed_override,
+    action_gear,
+    action_home,
+    action_clear_alarm,
+    action_tune,
 };
 
 
@@ -15,7 +15,7 @@
 extern "C" {
 #endif
 
-extern const uint8_t assets[18112];
+extern const uint8_t assets[30928];
 
 void ui_init();
 void ui_tick();
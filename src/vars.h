@@ -21,7 +21,19 @@ typedef enum {
     ENTRY_MICROSTEPS = 202,
     ENTRY_DEGREES_PER_SEC = 203,
     ENTRY_DIVISION_STEPS = 204,
-    ENTRY_DEGREES_ACCEL = 205
+    ENTRY_DEGREES_ACCEL = 205,
+    ENTRY_DIVISION_DWELL = 206,
+    ENTRY_DEGREES_JERK = 207,
+    ENTRY_BACKLASH = 208,
+    ENTRY_APPROACH = 209,
+    ENTRY_PITCH_POINT = 210,
+    ENTRY_PITCH_ERROR = 211,
+    ENTRY_PROGRAM = 212,
+    ENTRY_MILL_END = 106,
+    ENTRY_MILL_TURNS = 213,
+    ENTRY_GEAR_COUNTS = 214,
+    ENTRY_HOME_OFFSET = 107,
+    ENTRY_FEEDBACK_COUNTS = 215
 } ENTRY;
 
 // Flow global variables
@@ -73,6 +85,40 @@ extern float get_var_relative_move();
 extern void set_var_relative_move(float value);
 extern int32_t get_var_steps_per_rev();
 extern void set_var_steps_per_rev(int32_t value);
+extern int32_t get_var_division_dwell();
+extern void set_var_division_dwell(int32_t value);
+extern int32_t get_var_degrees_jerk();
+extern void set_var_degrees_jerk(int32_t value);
+extern float get_var_move_time();
+extern void set_var_move_time(float value);
+extern float get_var_cycle_time();
+extern void set_var_cycle_time(float value);
+extern int32_t get_var_backlash_steps();
+extern void set_var_backlash_steps(int32_t value);
+extern int32_t get_var_approach_direction();
+extern void set_var_approach_direction(int32_t value);
+extern int32_t get_var_pitch_point();
+extern void set_var_pitch_point(int32_t value);
+extern int32_t get_var_pitch_error();
+extern void set_var_pitch_error(int32_t value);
+extern int32_t get_var_selected_axis();
+extern void set_var_selected_axis(int32_t value);
+extern int32_t get_var_program_slot();
+extern void set_var_program_slot(int32_t value);
+extern int32_t get_var_feed_override();
+extern void set_var_feed_override(int32_t value);
+extern int32_t get_var_mill_turns();
+extern void set_var_mill_turns(int32_t value);
+extern float get_var_mill_end();
+extern void set_var_mill_end(float value);
+extern int32_t get_var_gear_counts();
+extern void set_var_gear_counts(int32_t value);
+extern float get_var_home_offset();
+extern void set_var_home_offset(float value);
+extern int32_t get_var_feedback_counts();
+extern void set_var_feedback_counts(int32_t value);
+extern int32_t get_var_motion_alarm();
+extern void set_var_motion_alarm(int32_t value);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,164 @@
+// Rotary Table drive setting conversion tests
+//
+// fixed cases of the step and angle conversions and of the position kept
+// across changes of the microstepping and degrees per rev, run on the host
+// with
+//   pio test -e native_test -f test_rescale
+
+#include "../../src/motion.h"
+#include "../../src/motion_task.h"
+#include <unity.h>
+
+static SimStepper table;
+static SimStepper tilt;
+
+// drive settings of the table, 200 steps per rev
+static void drive(int32_t micro, float degrees) {
+    steps_per_rev = 200;
+    micro_steps = micro;
+    degrees_per_rev = degrees;
+}
+
+// put the table at a step position
+static void place(int32_t steps) {
+    motion_post(MOTION_SET_POSITION, steps, 0);
+    motion_service();
+}
+
+// change the table drive settings like the settings screen does
+// returns the position it was left at
+static int32_t change(int32_t micro, float degrees) {
+    drive(micro, degrees);
+    set_drive();
+    motion_service();
+    motion_status_t status;
+    motion_get_status(&status);
+    return status.position[0];
+}
+
+void setUp() {
+    steppers[0] = &table;
+    steppers[1] = &tilt;
+    axis_config[1].steps_per_rev = 200;
+    axis_config[1].micro_steps = 16;
+    axis_config[1].degrees_per_rev = 90;
+    drive(16, 90);
+    set_angle_per_step();
+    place(0);
+}
+
+void tearDown() {}
+
+static void test_circle_steps() {
+    TEST_ASSERT_EQUAL_UINT32(12800, circle_steps);
+    drive(16, 72);
+    set_angle_per_step();
+    TEST_ASSERT_EQUAL_UINT32(16000, circle_steps);
+}
+
+static void test_steps_to_angle() {
+    TEST_ASSERT_EQUAL_UINT32(0, axis_steps_to_angle(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(ANGLE_TURN / 4, axis_steps_to_angle(0, 3200));
+    TEST_ASSERT_EQUAL_UINT32(0, axis_steps_to_angle(0, 12800 * 3));
+    // negative positions wrap into the turn
+    TEST_ASSERT_EQUAL_UINT32(ANGLE_TURN / 4 * 3,
+                             axis_steps_to_angle(0, -3200));
+    TEST_ASSERT_EQUAL_UINT32(ANGLE_TURN / 2, axis_steps_to_angle(0, -6400));
+    TEST_ASSERT_EQUAL_UINT32(axis_steps_to_angle(0, 10752),
+                             axis_steps_to_angle(0, INT32_MIN));
+}
+
+static void test_angle_to_steps() {
+    TEST_ASSERT_EQUAL_INT32(3200, axis_angle_to_steps(0, ANGLE_TURN / 4));
+    TEST_ASSERT_EQUAL_INT32(-3200, axis_angle_to_steps(0, -ANGLE_TURN / 4));
+    TEST_ASSERT_EQUAL_INT32(128000, axis_angle_to_steps(0, ANGLE_TURN * 10));
+    // rounded to the nearest step the same either way
+    int64_t half = ANGLE_TURN / 12800 / 2; // just under half a step
+    TEST_ASSERT_EQUAL_INT32(0, axis_angle_to_steps(0, half));
+    TEST_ASSERT_EQUAL_INT32(0, axis_angle_to_steps(0, -half));
+    TEST_ASSERT_EQUAL_INT32(1, axis_angle_to_steps(0, half + 1));
+    TEST_ASSERT_EQUAL_INT32(-1, axis_angle_to_steps(0, -(half + 1)));
+}
+
+static void test_rescale_fixed() {
+    TEST_ASSERT_EQUAL_INT32(25, rescale_steps(100, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(0, rescale_steps(1, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(1, rescale_steps(2, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(1, rescale_steps(3, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(2, rescale_steps(6, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(15434, rescale_steps(12347, 12800, 16000));
+    TEST_ASSERT_EQUAL_INT32(12347, rescale_steps(15434, 16000, 12800));
+    TEST_ASSERT_EQUAL_INT32(16000 * 7, rescale_steps(12800 * 7, 12800, 16000));
+}
+
+static void test_rescale_negative() {
+    TEST_ASSERT_EQUAL_INT32(0, rescale_steps(-1, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(0, rescale_steps(-2, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(-1, rescale_steps(-3, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(-4000, rescale_steps(-3200 * 5, 3200, 800));
+    TEST_ASSERT_EQUAL_INT32(-25, rescale_steps(-100, 3200, 800));
+}
+
+static void test_rescale_overflow() {
+    // the whole turns don't fit so only the rest of the turn is kept
+    TEST_ASSERT_EQUAL_INT32(12032, rescale_steps(INT32_MAX, 200, 51200));
+    TEST_ASSERT_EQUAL_INT32(51200 - 12032,
+                            rescale_steps(-INT32_MAX, 200, 51200));
+    // and the ones that just fit are kept
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX / 256 * 256,
+                            rescale_steps(INT32_MAX / 256, 200, 51200));
+    TEST_ASSERT_EQUAL_INT32(536870912, rescale_steps(INT32_MAX, 800, 200));
+}
+
+// coarser and back comes back to the same step, not a step off it
+static void test_round_trip() {
+    place(12347);
+    TEST_ASSERT_EQUAL_INT32(3087, change(4, 90));
+    TEST_ASSERT_EQUAL_INT32(12347, change(16, 90));
+    place(-12347);
+    TEST_ASSERT_EQUAL_INT32(-3087, change(4, 90));
+    TEST_ASSERT_EQUAL_INT32(-12347, change(16, 90));
+}
+
+// circles that aren't multiples of each other come back the same way,
+// and each change is rounded from where it started
+static void test_round_trip_non_multiple() {
+    place(12347);
+    TEST_ASSERT_EQUAL_INT32(15434, change(16, 72));
+    TEST_ASSERT_EQUAL_INT32(3858, change(4, 72));
+    TEST_ASSERT_EQUAL_INT32(3087, change(4, 90));
+    TEST_ASSERT_EQUAL_INT32(12347, change(16, 90));
+}
+
+// a move after a change starts the next change from there
+static void test_moved() {
+    place(12347);
+    TEST_ASSERT_EQUAL_INT32(3087, change(4, 90));
+    place(3088);
+    TEST_ASSERT_EQUAL_INT32(12352, change(16, 90));
+}
+
+// the whole turns that don't fit are dropped and come back on the way back
+static void test_round_trip_overflow() {
+    drive(1, 90);
+    set_angle_per_step();
+    place(INT32_MAX);
+    TEST_ASSERT_EQUAL_INT32(rescale_steps(INT32_MAX, 800, 204800),
+                            change(256, 90));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, change(1, 90));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_circle_steps);
+    RUN_TEST(test_steps_to_angle);
+    RUN_TEST(test_angle_to_steps);
+    RUN_TEST(test_rescale_fixed);
+    RUN_TEST(test_rescale_negative);
+    RUN_TEST(test_rescale_overflow);
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_round_trip_non_multiple);
+    RUN_TEST(test_moved);
+    RUN_TEST(test_round_trip_overflow);
+    return UNITY_END();
+}
@@ -0,0 +1,83 @@
+// Rotary Table simulator checks as unit tests
+//
+// each feature of the simulator is run on its own for a few rounds of
+// random settings, a failed check is reported with its name, the seed and
+// round and the values it failed on, run on the host with
+//   pio test -e native_test -f test_sim
+// the simulator itself runs them all for many more rounds
+
+#include "../../src/sim/profile_run.h"
+#include "../../src/sim/sim_checks.h"
+#include <unity.h>
+
+#define TEST_SEED 1   // seed of the random settings
+#define TEST_ROUNDS 5 // rounds of each feature
+
+void setUp() { sim_begin(TEST_SEED, 0.5); }
+
+void tearDown() {}
+
+// run a feature for the rounds, checks that fail are kept in sim_stats
+static void run(void (*feature)()) {
+    for (uint32_t round = 0; round < TEST_ROUNDS; round++) {
+        sim_round(round);
+        feature();
+    }
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, sim_stats.failures,
+                                     sim_stats.failure);
+    TEST_ASSERT_TRUE(sim_stats.moves > 0);
+}
+
+// the division program runs the divisions just set up
+static void divisions() {
+    sim_divisions();
+    sim_division_program();
+}
+
+static void test_divisions() { run(divisions); }
+static void test_program() { run(sim_program); }
+static void test_milling() { run(sim_milling); }
+static void test_gearing() { run(sim_gearing); }
+static void test_homing() { run(sim_homing); }
+static void test_feedback() { run(sim_feedback); }
+static void test_estop() { run(sim_estop); }
+static void test_absolute_moves() { run(sim_absolute_moves); }
+static void test_relative_moves() { run(sim_relative_moves); }
+static void test_blends() { run(sim_blends); }
+static void test_serial_order() { run(sim_serial_order); }
+static void test_sync_moves() { run(sim_sync_moves); }
+static void test_tuning() { run(sim_tuning); }
+static void test_rescale() { run(sim_rescale); }
+
+static void test_circle_steps() {
+    sim_circle_steps();
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, sim_stats.failures,
+                                     sim_stats.failure);
+}
+
+static void test_profile_peaks() {
+    peaks_t plain;
+    peaks_t jerked;
+    TEST_ASSERT_TRUE(profile_check(&plain, &jerked));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_circle_steps);
+    RUN_TEST(test_profile_peaks);
+    RUN_TEST(test_divisions);
+    RUN_TEST(test_program);
+    RUN_TEST(test_milling);
+    RUN_TEST(test_gearing);
+    RUN_TEST(test_homing);
+    RUN_TEST(test_feedback);
+    RUN_TEST(test_estop);
+    RUN_TEST(test_absolute_moves);
+    RUN_TEST(test_relative_moves);
+    RUN_TEST(test_blends);
+    RUN_TEST(test_serial_order);
+    RUN_TEST(test_sync_moves);
+    RUN_TEST(test_tuning);
+    RUN_TEST(test_rescale);
+    return UNITY_END();
+}